@@ -0,0 +1,69 @@
+/**
+ * Time lower bound searches of a large sorted vector with vector_lower_bound()
+ * and with vector_eytzinger_lower_bound() on its Eytzinger layout.
+ *
+ * Each round searches for a pseudorandom key. Usage:
+ * benchmark_vector_eytzinger [length [rounds]]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <vector.h>
+
+static int cmp(const void *a, const void *b) {
+  uint32_t x = *(const uint32_t *) a, y = *(const uint32_t *) b;
+  return (x > y) - (x < y);
+}
+
+static double search(bool layout, const uint32_t *vector, size_t rounds) {
+  struct timespec start, stop;
+  size_t sum = 0;
+  uint32_t seed = 1;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (size_t r = 0; r < rounds; r++) {
+    seed = seed * 1103515245 + 12345;
+    sum += layout
+      ? vector_eytzinger_lower_bound(vector, &seed, cmp)
+      : vector_lower_bound(vector, &seed, cmp);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &stop);
+
+  double elapsed = (double) (stop.tv_sec - start.tv_sec)
+    + (double) (stop.tv_nsec - start.tv_nsec) / 1e9;
+  printf("%-10s %12.6f %12.2f %20zu\n", layout ? "eytzinger" : "sorted",
+      elapsed, elapsed / (double) rounds * 1e9, sum);
+  return elapsed;
+}
+
+int main(int argc, char *argv[]) {
+  size_t length = argc > 1 ? strtoul(argv[1], NULL, 10) : 10000000;
+  size_t rounds = argc > 2 ? strtoul(argv[2], NULL, 10) : 1000000;
+  uint32_t *vector, *layout;
+
+  // evenly spaced keys over the range of uint32_t
+  if ((vector = vector_create()) == NULL)
+    return perror("vector_create"), EXIT_FAILURE;
+  for (size_t i = 0; i < length; i++) {
+    uint32_t key = (uint32_t) (i * (UINT32_MAX / (length + 1))), *result;
+    if ((result = vector_append(vector, &key)) == NULL)
+      return perror("vector_append"), vector_delete(vector), EXIT_FAILURE;
+    vector = result;
+  }
+  if ((layout = vector_eytzinger(vector)) == NULL)
+    return perror("vector_eytzinger"), vector_delete(vector), EXIT_FAILURE;
+
+  printf("length = %zu, rounds = %zu\n", length, rounds);
+  printf("%-10s %12s %12s %20s\n", "layout", "seconds", "ns per op",
+      "checksum");
+  int status = search(false, vector, rounds) < 0
+    || search(true, layout, rounds) < 0;
+
+  vector_delete(layout);
+  vector_delete(vector);
+  return status ? EXIT_FAILURE : EXIT_SUCCESS;
+}
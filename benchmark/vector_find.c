@@ -0,0 +1,63 @@
+/**
+ * Time finding integer IDs in a vector with vector_find() and an equality
+ * function and with vector_find_value().
+ *
+ * Each round looks up an ID at a pseudorandom index in the vector. Usage:
+ * benchmark_vector_find [length [rounds]]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <vector.h>
+
+static bool eqint(const void *a, const void *b) {
+  return *(const uint32_t *) a == *(const uint32_t *) b;
+}
+
+static double find(bool value, const uint32_t *vector, size_t rounds) {
+  struct timespec start, stop;
+  size_t length = vector_length(vector), sum = 0;
+  uint32_t seed = 1;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (size_t r = 0; r < rounds; r++) {
+    seed = seed * 1103515245 + 12345;
+    uint32_t id = vector[seed % length];
+    sum += value
+      ? vector_find_value(vector, &id)
+      : vector_find(vector, eqint, &id);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &stop);
+
+  double elapsed = (double) (stop.tv_sec - start.tv_sec)
+    + (double) (stop.tv_nsec - start.tv_nsec) / 1e9;
+  printf("%-8s %12.6f %12.2f %20zu\n", value ? "value" : "eqf", elapsed,
+      elapsed / (double) rounds * 1e6, sum);
+  return elapsed;
+}
+
+int main(int argc, char *argv[]) {
+  size_t length = argc > 1 ? strtoul(argv[1], NULL, 10) : 100000;
+  size_t rounds = argc > 2 ? strtoul(argv[2], NULL, 10) : 10000;
+  uint32_t *vector;
+
+  if (length == 0 || (vector = vector_create()) == NULL)
+    return EXIT_FAILURE;
+  for (uint32_t i = 0; i < length; i++) {
+    uint32_t id = i * 2654435761u, *result;
+    if ((result = vector_append(vector, &id)) == NULL)
+      return perror("vector_append"), vector_delete(vector), EXIT_FAILURE;
+    vector = result;
+  }
+
+  printf("length = %zu, rounds = %zu\n", length, rounds);
+  printf("%-8s %12s %12s %20s\n", "mode", "seconds", "us per op", "checksum");
+  if (find(false, vector, rounds) < 0 || find(true, vector, rounds) < 0)
+    return vector_delete(vector), EXIT_FAILURE;
+  vector_delete(vector);
+  return EXIT_SUCCESS;
+}
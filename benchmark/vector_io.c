@@ -0,0 +1,110 @@
+/**
+ * Time reading a large file in /tmp into a vector through a buffer on the
+ * stack and vector_extend() against reading straight into the vector.
+ *
+ * The file is written once and then read in whole by each method the given
+ * number of rounds, so it's read from the page cache. Usage:
+ * benchmark_vector_io [megabytes [rounds]]
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <vector.h>
+
+#define CHUNK 65536
+
+enum method_t { BUFFERED, EXTEND, EXTENDV };
+
+static const char *name[] = { "buffered", "fd", "fdv" };
+
+static char *slurp(enum method_t method, int fd) {
+  char buffer[CHUNK];
+  char *vector, *result;
+  ssize_t count = 0;
+
+  if ((vector = vector_create()) == NULL)
+    return NULL;
+
+  do {
+    switch (method) {
+    case BUFFERED:
+      result = vector;
+      if ((count = read(fd, buffer, sizeof(buffer))) > 0)
+        result = vector_extend(vector, buffer, (size_t) count);
+      break;
+    case EXTEND:
+      result = vector_extend_from_fd(vector, fd, CHUNK, &count);
+      break;
+    case EXTENDV:
+      result = vector_extend_from_fdv(vector, fd, CHUNK, &count);
+      break;
+    }
+    if (result == NULL)
+      return vector_delete(vector);
+    vector = result;
+  } while (count > 0);
+
+  if (count < 0)
+    return vector_delete(vector);
+  return vector;
+}
+
+static double measure(
+    enum method_t method, const char *path, size_t size, size_t rounds) {
+  struct timespec start, stop;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (size_t r = 0; r < rounds; r++) {
+    int fd;
+    char *vector;
+
+    if ((fd = open(path, O_RDONLY)) < 0)
+      return perror("open"), -1;
+    if ((vector = slurp(method, fd)) == NULL)
+      return perror(name[method]), close(fd), -1;
+    close(fd);
+    if (vector_length(vector) != size)
+      return fprintf(stderr, "%s: short read\n", name[method]), -1;
+    vector_delete(vector);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &stop);
+
+  double elapsed = (double) (stop.tv_sec - start.tv_sec)
+    + (double) (stop.tv_nsec - start.tv_nsec) / 1e9;
+  printf("%-8s %12.6f %12.1f\n", name[method], elapsed,
+      (double) (size * rounds) / elapsed / (1 << 20));
+  return elapsed;
+}
+
+int main(int argc, char *argv[]) {
+  size_t megabytes = argc > 1 ? strtoul(argv[1], NULL, 10) : 256;
+  size_t rounds = argc > 2 ? strtoul(argv[2], NULL, 10) : 10;
+  size_t size = megabytes << 20;
+  char path[] = "/tmp/benchmark_vector_io.XXXXXX";
+  char block[1 << 20];
+  int fd;
+
+  if ((fd = mkstemp(path)) < 0)
+    return perror("mkstemp"), EXIT_FAILURE;
+  memset(block, 'x', sizeof(block));
+  for (size_t i = 0; i < megabytes; i++)
+    if (write(fd, block, sizeof(block)) != (ssize_t) sizeof(block))
+      return perror("write"), close(fd), unlink(path), EXIT_FAILURE;
+  close(fd);
+
+  printf("size = %zu MiB, rounds = %zu\n", megabytes, rounds);
+  printf("%-8s %12s %12s\n", "method", "seconds", "MiB/s");
+  int status = EXIT_SUCCESS;
+  for (enum method_t method = BUFFERED; method <= EXTENDV; method++)
+    if (measure(method, path, size, rounds) < 0)
+      status = EXIT_FAILURE;
+
+  unlink(path);
+  return status;
+}
@@ -0,0 +1,88 @@
+/**
+ * Count the reallocations of push/pull churn on a vector with and without a
+ * pinned volume.
+ *
+ * Each round pushes a number of elements onto an empty vector and then pulls
+ * each of them off again. Usage: benchmark_vector_pin [length [rounds]]
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <vector.h>
+
+struct count_t {
+  size_t allocate;
+  size_t reallocate;
+  size_t deallocate;
+};
+
+static void *count_allocate(size_t size, void *context) {
+  ((struct count_t *) context)->allocate++;
+  return malloc(size);
+}
+
+static void *count_reallocate(
+    void *data, size_t prior, size_t size, void *context) {
+  (void) prior;
+  ((struct count_t *) context)->reallocate++;
+  return realloc(data, size);
+}
+
+static void count_deallocate(void *data, size_t size, void *context) {
+  (void) size;
+  ((struct count_t *) context)->deallocate++;
+  free(data);
+}
+
+static double churn(bool pin, size_t length, size_t rounds) {
+  struct count_t count = { 0, 0, 0 };
+  struct vector_allocator_t allocator = {
+    .allocate = count_allocate,
+    .reallocate = count_reallocate,
+    .deallocate = count_deallocate,
+    .context = &count,
+  };
+  struct timespec start, stop;
+  size_t *vector;
+
+  if ((vector = vector_create_using(&allocator)) == NULL)
+    return perror("vector_create_using"), -1;
+  if (pin)
+    vector_pin(vector);
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (size_t r = 0; r < rounds; r++) {
+    for (size_t i = 0; i < length; i++) {
+      size_t *result;
+      if ((result = vector_push(vector, &i)) == NULL)
+        return perror("vector_push"), vector_delete(vector), -1;
+      vector = result;
+    }
+    while (vector_length(vector) > 0)
+      vector = vector_pull(vector, NULL);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &stop);
+
+  vector_delete(vector);
+
+  double elapsed = (double) (stop.tv_sec - start.tv_sec)
+    + (double) (stop.tv_nsec - start.tv_nsec) / 1e9;
+  printf("%-8s %12zu %12zu %12.6f\n",
+      pin ? "pinned" : "unpinned", count.reallocate,
+      count.reallocate / rounds, elapsed);
+  return elapsed;
+}
+
+int main(int argc, char *argv[]) {
+  size_t length = argc > 1 ? strtoul(argv[1], NULL, 10) : 100000;
+  size_t rounds = argc > 2 ? strtoul(argv[2], NULL, 10) : 100;
+
+  printf("length = %zu, rounds = %zu\n", length, rounds);
+  printf("%-8s %12s %12s %12s\n", "mode", "realloc", "per round", "seconds");
+  if (churn(false, length, rounds) < 0 || churn(true, length, rounds) < 0)
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,60 @@
+/**
+ * Time a vector used as a work queue with and without ring mode.
+ *
+ * The queue is filled with a number of elements and then each round shifts
+ * the first element off and pushes another on. Usage:
+ * benchmark_vector_ring [length [rounds]]
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <vector.h>
+
+static double queue(bool ring, size_t length, size_t rounds) {
+  struct timespec start, stop;
+  size_t *vector, *result, sum = 0;
+
+  if ((vector = vector_create()) == NULL)
+    return perror("vector_create"), -1;
+  if (ring && vector_ring(vector) == NULL)
+    return perror("vector_ring"), vector_delete(vector), -1;
+
+  for (size_t i = 0; i < length; i++) {
+    if ((result = vector_push(vector, &i)) == NULL)
+      return perror("vector_push"), vector_delete(vector), -1;
+    vector = result;
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (size_t r = 0; r < rounds; r++) {
+    size_t elmt;
+    vector = vector_shift(vector, &elmt);
+    sum += elmt;
+    if ((result = vector_push(vector, &r)) == NULL)
+      return perror("vector_push"), vector_delete(vector), -1;
+    vector = result;
+  }
+  clock_gettime(CLOCK_MONOTONIC, &stop);
+
+  vector_delete(vector);
+
+  double elapsed = (double) (stop.tv_sec - start.tv_sec)
+    + (double) (stop.tv_nsec - start.tv_nsec) / 1e9;
+  printf("%-8s %12.6f %12.2f %20zu\n", ring ? "ring" : "linear", elapsed,
+      elapsed / (double) rounds * 1e9, sum);
+  return elapsed;
+}
+
+int main(int argc, char *argv[]) {
+  size_t length = argc > 1 ? strtoul(argv[1], NULL, 10) : 100000;
+  size_t rounds = argc > 2 ? strtoul(argv[2], NULL, 10) : 100000;
+
+  printf("length = %zu, rounds = %zu\n", length, rounds);
+  printf("%-8s %12s %12s %20s\n", "mode", "seconds", "ns per op", "checksum");
+  if (queue(false, length, rounds) < 0 || queue(true, length, rounds) < 0)
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,87 @@
+/**
+ * Time searches of a large sorted vector for a batch of keys, one at a time
+ * with vector_search() and together with vector_search_many(), for keys in a
+ * random order and in sorted order.
+ *
+ * Usage: benchmark_vector_search_many [length [nkeys]]
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <vector.h>
+
+static int cmp(const void *a, const void *b) {
+  uint32_t x = *(const uint32_t *) a, y = *(const uint32_t *) b;
+  return (x > y) - (x < y);
+}
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double) t.tv_sec + (double) t.tv_nsec / 1e9;
+}
+
+static void report(const char *name, double elapsed, size_t *out, size_t n) {
+  size_t sum = 0;
+  for (size_t k = 0; k < n; k++)
+    sum += out[k];
+  printf("%-16s %12.6f %12.2f %20zu\n", name, elapsed,
+      elapsed / (double) n * 1e9, sum);
+}
+
+static void batch(const char *order, const uint32_t *vector,
+    const uint32_t *keys, size_t nkeys, size_t *out) {
+  char name[32];
+  double start = now();
+  for (size_t k = 0; k < nkeys; k++)
+    out[k] = vector_search(vector, &keys[k], cmp);
+  snprintf(name, sizeof(name), "%s single", order);
+  report(name, now() - start, out, nkeys);
+
+  start = now();
+  vector_search_many(vector, keys, nkeys, cmp, out);
+  snprintf(name, sizeof(name), "%s many", order);
+  report(name, now() - start, out, nkeys);
+}
+
+int main(int argc, char *argv[]) {
+  size_t length = argc > 1 ? strtoul(argv[1], NULL, 10) : 10000000;
+  size_t nkeys = argc > 2 ? strtoul(argv[2], NULL, 10) : 1000000;
+  uint32_t *vector, *keys;
+  size_t *out;
+
+  if ((vector = vector_create()) == NULL)
+    return perror("vector_create"), EXIT_FAILURE;
+  if ((vector = vector_resize(vector, length)) == NULL)
+    return perror("vector_resize"), EXIT_FAILURE;
+  vector = vector_extend(vector, NULL, length);
+  for (size_t i = 0; i < length; i++)
+    vector[i] = (uint32_t) (i * 2);
+
+  if ((keys = malloc(nkeys * sizeof(*keys))) == NULL)
+    return perror("malloc"), EXIT_FAILURE;
+  if ((out = malloc(nkeys * sizeof(*out))) == NULL)
+    return perror("malloc"), EXIT_FAILURE;
+
+  uint32_t seed = 1;
+  for (size_t k = 0; k < nkeys; k++) {
+    seed = seed * 1103515245 + 12345;
+    keys[k] = (uint32_t) (seed % (2 * length));
+  }
+
+  printf("length = %zu, nkeys = %zu\n", length, nkeys);
+  printf("%-16s %12s %12s %20s\n", "mode", "seconds", "ns per key",
+      "checksum");
+  batch("random", vector, keys, nkeys, out);
+
+  qsort(keys, nkeys, sizeof(*keys), cmp);
+  batch("sorted", vector, keys, nkeys, out);
+
+  free(out);
+  free(keys);
+  vector_delete(vector);
+  return EXIT_SUCCESS;
+}
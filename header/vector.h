@@ -40,7 +40,8 @@
  * to create a vector with the same length as @a source.
  *
  * If either of these are successful then memcpy() each element in @a source
- * into the new vector.
+ * into the new vector. The new vector is bound to the same allocator as
+ * @a source.
  *
  * If this fails then it will set @c errno to @c ENOMEM.
  *
@@ -57,17 +58,49 @@ vector_t vector_duplicate_z(vector_c source, size_t z)
 #define vector_duplicate(source) \
   vector_duplicate_z(source, VECTOR_Z((source)))
 
+/**
+ * @brief Allocate and initialize a vector with elements aligned to
+ *   @a alignment bytes by duplicating @a source
+ *
+ * This is vector_duplicate_z() except that the new vector is bound to
+ * vector_aligned() of @a alignment rather than the allocator of @a source. If
+ * @a alignment isn't valid for vector_aligned() then this will set @c errno to
+ * @c EINVAL.
+ *
+ * @return the vector on success; otherwise @c NULL
+ *
+ * @see vector_duplicate_aligned() - The implicit interface analogue
+ * @see vector_duplicate_aligned_z() - The explicit interface analogue
+ */
+vector_t vector_duplicate_aligned_z(vector_c source, size_t alignment, size_t z)
+  __attribute__((__malloc__, nonnull));
+
+/// @copydoc vector_duplicate_aligned_z()
+//= vector_t vector_duplicate_aligned(vector_c source, size_t alignment)
+#define vector_duplicate_aligned(source, alignment) \
+  vector_duplicate_aligned_z(source, alignment, VECTOR_Z((source)))
+
 #include "vector/access.h"
+#include "vector/align.h"
+#include "vector/allocator.h"
+#include "vector/arena.h"
+#include "vector/cache.h"
 #include "vector/comparison.h"
 #include "vector/create.h"
 #include "vector/debug.h"
 #include "vector/delete.h"
 #include "vector/insert.h"
+#include "vector/mmap.h"
 #include "vector/move.h"
+#include "vector/policy.h"
 #include "vector/remove.h"
 #include "vector/resize.h"
+#include "vector/ring.h"
 #include "vector/search.h"
+#include "vector/eytzinger.h"
 #include "vector/shift.h"
+#include "vector/io.h"
 #include "vector/sort.h"
+#include "vector/stats.h"
 
 #endif /* VECTOR_H */
@@ -0,0 +1,114 @@
+/// @file header/vector/align.c
+
+#ifndef VECTOR_ALIGN_C
+#define VECTOR_ALIGN_C
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "align.h"
+#include "allocator.h"
+#include "create.h"
+
+#ifdef VECTOR_TEST
+#define inline
+#endif /* VECTOR_TEST */
+
+inline const struct vector_allocator_t *vector_aligned(size_t alignment) {
+  size_t i = 0;
+
+  if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+    return errno = EINVAL, NULL;
+  if (alignment > VECTOR_ALIGNMENT_LIMIT)
+    return errno = EINVAL, NULL;
+
+  if (alignment < _Alignof(max_align_t))
+    alignment = _Alignof(max_align_t);
+  while (((size_t) 1 << i) < alignment)
+    i++;
+  return &__vector_aligned[i];
+}
+
+inline vector_t vector_create_aligned(size_t alignment) {
+  const struct vector_allocator_t *allocator;
+
+  if ((allocator = vector_aligned(alignment)) == NULL)
+    return NULL;
+  return vector_create_using(allocator);
+}
+
+inline vector_t vector_import_aligned_z(
+    size_t alignment, const void *data, size_t length, size_t z) {
+  const struct vector_allocator_t *allocator;
+
+  if ((allocator = vector_aligned(alignment)) == NULL)
+    return NULL;
+  return vector_import_using_z(allocator, data, length, z);
+}
+
+inline size_t __vector_aligned_offset(const void *base, size_t alignment) {
+  size_t header = sizeof(struct __vector_header_t);
+  uintptr_t data = (uintptr_t) base + sizeof(size_t) + header;
+
+  // round the address of the first element up to a multiple of alignment
+  data = (data + alignment - 1) & ~(uintptr_t) (alignment - 1);
+  return (size_t) (data - header - (uintptr_t) base);
+}
+
+inline void *__vector_aligned_allocate(size_t size, void *context) {
+  size_t alignment = *(size_t *) context;
+  size_t offset;
+  char *base;
+
+  // room for the offset and a misaligned base
+  if (__builtin_add_overflow(size, alignment + sizeof(size_t), &size))
+    return errno = ENOMEM, NULL;
+  if ((base = malloc(size)) == NULL)
+    return NULL;
+
+  offset = __vector_aligned_offset(base, alignment);
+  memcpy(base + offset - sizeof(size_t), &offset, sizeof(size_t));
+  return base + offset;
+}
+
+inline void *__vector_aligned_reallocate(
+    void *data, size_t prior, size_t size, void *context) {
+  size_t alignment = *(size_t *) context;
+  size_t offset, result;
+  char *base;
+
+  memcpy(&offset, (char *) data - sizeof(size_t), sizeof(size_t));
+
+  if (__builtin_add_overflow(size, alignment + sizeof(size_t), &size))
+    return errno = ENOMEM, NULL;
+  if ((base = realloc((char *) data - offset, size)) == NULL)
+    return NULL;
+  size -= alignment + sizeof(size_t);
+
+  // realloc() retains the alignment of the base only up to max_align_t, so the
+  // vector must be moved if its placement in the allocation has changed
+  if ((result = __vector_aligned_offset(base, alignment)) != offset) {
+    memmove(base + result, base + offset, prior < size ? prior : size);
+    memcpy(base + result - sizeof(size_t), &result, sizeof(size_t));
+  }
+  return base + result;
+}
+
+inline void __vector_aligned_deallocate(
+    void *data, size_t size, void *context) {
+  size_t offset;
+  (void) size, (void) context;
+
+  memcpy(&offset, (char *) data - sizeof(size_t), sizeof(size_t));
+  free((char *) data - offset);
+}
+
+#ifdef VECTOR_TEST
+#undef inline
+#endif /* VECTOR_TEST */
+
+#endif /* VECTOR_ALIGN_C */
@@ -0,0 +1,133 @@
+/// @file header/vector/align.h
+
+#ifndef VECTOR_ALIGN_H
+#define VECTOR_ALIGN_H
+
+#include <stddef.h>
+#include "common.h"
+#include "allocator.h"
+
+#ifdef VECTOR_TEST
+#define inline
+#endif /* VECTOR_TEST */
+
+/// The greatest alignment in bytes of the elements of an aligned vector
+#define VECTOR_ALIGNMENT_LIMIT ((size_t) 1 << 16)
+
+/**
+ * @brief Return an allocator that aligns the elements of each vector bound to
+ *   it to @a alignment bytes
+ *
+ * Each allocation through the allocator is obtained from malloc() with enough
+ * room to place the vector's header so that its first element is at an address
+ * that's a multiple of @a alignment. As the vector's header is just before its
+ * first element, this also ensures that none of its elements share a cache line
+ * (of at most @a alignment bytes) with its header. The alignment is retained
+ * when the vector is resized, as realloc() is followed by a memmove() of the
+ * vector if its placement changes, and when it's duplicated with
+ * vector_duplicate().
+ *
+ * An @a alignment less than <code>alignof(max_align_t)</code> is rounded up to
+ * it. If @a alignment isn't a power of two or is greater than
+ * @ref VECTOR_ALIGNMENT_LIMIT then this will set @c errno to @c EINVAL.
+ *
+ * @return the allocator on success; otherwise @c NULL
+ */
+inline const struct vector_allocator_t *vector_aligned(size_t alignment);
+
+/**
+ * @brief Allocate and initialize a zero length vector with elements aligned to
+ *   @a alignment bytes
+ *
+ * This is vector_create_using() with vector_aligned(). On failure this will
+ * either set @c errno to @c EINVAL as vector_aligned() does or retain the value
+ * of @c errno set by malloc().
+ *
+ * For example: @code{.c}
+ *   float *vector = vector_create_aligned(64);
+ * @endcode
+ *
+ * @return the new vector on success; otherwise @c NULL
+ */
+inline vector_t vector_create_aligned(size_t alignment)
+  __attribute__((__malloc__));
+
+/**
+ * @brief Allocate and initialize a vector with elements aligned to
+ *   @a alignment bytes from @a length elements of @a data
+ *
+ * This is vector_import_using() with vector_aligned(). On failure this will
+ * either set @c errno to @c EINVAL as vector_aligned() does or retain the value
+ * of @c errno set by malloc().
+ *
+ * @param alignment the alignment in bytes of the elements of the vector
+ * @param data the data to initialize the vector from
+ * @param length the number of elements to copy from @a data
+ * @return the new vector on success; otherwise @c NULL
+ *
+ * @see vector_import_aligned_z() - the explicit interface analogue
+ */
+//= vector_t vector_import_aligned(
+//=     size_t alignment, const void *data, size_t length)
+#define vector_import_aligned(alignment, data, length) \
+  vector_import_aligned_z((alignment), (data), (length), VECTOR_Z((data)))
+
+/**
+ * @brief Allocate and initialize a vector with elements aligned to
+ *   @a alignment bytes from @a length elements of @a data
+ *
+ * This is vector_import_using_z() with vector_aligned(). On failure this will
+ * either set @c errno to @c EINVAL as vector_aligned() does or retain the value
+ * of @c errno set by malloc().
+ *
+ * @param alignment the alignment in bytes of the elements of the vector
+ * @param data the data to initialize the vector from
+ * @param length the number of elements to copy from @a data
+ * @param z the element size of @a data
+ * @return the new vector on success; otherwise @c NULL
+ *
+ * @see vector_import_aligned() - the implicit interface analogue
+ */
+inline vector_t vector_import_aligned_z(
+    size_t alignment, const void *data, size_t length, size_t z)
+  __attribute__((__malloc__, nonnull(2)));
+
+/// @cond INTERNAL
+
+/// The aligned allocator of each power of two alignment up to
+/// @ref VECTOR_ALIGNMENT_LIMIT indexed by the logarithm of its alignment
+extern const struct vector_allocator_t __vector_aligned[];
+
+/**
+ * @brief Return the offset from an allocation from malloc() at @a base to the
+ *   header of a vector with elements aligned to @a alignment bytes
+ *
+ * This leaves room for a @c size_t just before the header.
+ */
+inline size_t __vector_aligned_offset(const void *base, size_t alignment)
+  __attribute__((const));
+
+/// The @ref vector_allocator_t::allocate of an aligned allocator
+inline void *__vector_aligned_allocate(size_t size, void *context)
+  __attribute__((nonnull(2)));
+
+/// The @ref vector_allocator_t::reallocate of an aligned allocator
+inline void *__vector_aligned_reallocate(
+    void *data, size_t prior, size_t size, void *context)
+  __attribute__((nonnull(1, 4)));
+
+/// The @ref vector_allocator_t::deallocate of an aligned allocator
+inline void __vector_aligned_deallocate(void *data, size_t size, void *context)
+  __attribute__((nonnull(1)));
+
+/// @endcond
+
+#ifdef VECTOR_TEST
+#undef inline
+#endif /* VECTOR_TEST */
+
+#endif /* VECTOR_ALIGN_H */
+
+#ifndef VECTOR_TEST
+#include "align.c"
+#endif /* VECTOR_TEST */
@@ -0,0 +1,92 @@
+/// @file header/vector/allocator.c
+
+#ifndef VECTOR_ALLOCATOR_C
+#define VECTOR_ALLOCATOR_C
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#if defined(__linux__)
+#include <malloc.h>
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#endif
+
+#include "common.h"
+#include "allocator.h"
+#include "stats.h"
+
+#ifdef VECTOR_TEST
+#define inline
+#endif /* VECTOR_TEST */
+
+inline const struct vector_allocator_t *vector_allocator(vector_c vector) {
+  return __vector_to_header(vector)->allocator;
+}
+
+inline void *__vector_allocate(
+    const struct vector_allocator_t *allocator, size_t size) {
+  void *result;
+
+  if (allocator == NULL)
+    result = malloc(size);
+  else
+    result = allocator->allocate(size, allocator->context);
+
+  __vector_stats_add(allocate, 1);
+  __vector_stats_add(allocate_bytes, size);
+  if (result == NULL)
+    __vector_stats_add(failure, 1);
+  return result;
+}
+
+inline void *__vector_reallocate(
+    const struct vector_allocator_t *allocator,
+    void *data,
+    size_t prior,
+    size_t size) {
+  void *result;
+
+  if (allocator == NULL)
+    result = realloc(data, size);
+  else
+    result = allocator->reallocate(data, prior, size, allocator->context);
+
+  __vector_stats_add(reallocate, 1);
+  __vector_stats_add(reallocate_bytes, size);
+  if (result == NULL)
+    __vector_stats_add(failure, 1);
+  return result;
+}
+
+inline void __vector_deallocate(
+    const struct vector_allocator_t *allocator, void *data, size_t size) {
+  if (allocator == NULL)
+    free(data);
+  else
+    allocator->deallocate(data, size, allocator->context);
+}
+
+inline size_t __vector_usable(
+    const struct vector_allocator_t *allocator, void *data, size_t size) {
+  size_t usable = size;
+
+  if (allocator != NULL) {
+    if (allocator->usable != NULL)
+      usable = allocator->usable(data, size, allocator->context);
+  } else {
+#if defined(__linux__)
+    usable = malloc_usable_size(data);
+#elif defined(__APPLE__)
+    usable = malloc_size(data);
+#endif
+  }
+
+  return usable > size ? usable : size;
+}
+
+#ifdef VECTOR_TEST
+#undef inline
+#endif /* VECTOR_TEST */
+
+#endif /* VECTOR_ALLOCATOR_C */
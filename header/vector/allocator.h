@@ -0,0 +1,111 @@
+/// @file header/vector/allocator.h
+
+#ifndef VECTOR_ALLOCATOR_H
+#define VECTOR_ALLOCATOR_H
+
+#include <stddef.h>
+#include "common.h"
+
+#ifdef VECTOR_TEST
+#define inline
+#endif /* VECTOR_TEST */
+
+/**
+ * @brief An allocator that a vector can be bound to
+ *
+ * A vector created with vector_create_using() or vector_import_using() is bound
+ * to its allocator for its entire lifetime. Each allocation, reallocation, and
+ * deallocation of the vector (through vector_resize(), vector_duplicate(),
+ * vector_delete(), etc.) is done through the allocator's functions instead of
+ * malloc(), realloc(), and free(). A vector created with vector_create() or
+ * vector_import() isn't bound to an allocator and uses malloc(), realloc(), and
+ * free() directly.
+ *
+ * The allocator isn't copied into the vector; the vector retains a pointer to
+ * it. As a result the allocator must outlive each vector bound to it.
+ *
+ * Each function is called with the allocator's @a context as its last argument.
+ * Each @a size is the size in bytes of an entire allocation, including the
+ * vector's header. Like malloc() and realloc(), the result of @a allocate and
+ * @a reallocate must be suitably aligned for any object type with fundamental
+ * alignment. On failure they should return @c NULL and set @c errno, and on
+ * failure @a reallocate must leave @a data unmodified.
+ */
+struct vector_allocator_t {
+  /// Allocate and return @a size bytes or return @c NULL
+  void *(*allocate)(size_t size, void *context);
+
+  /**
+   * @brief Resize the @a prior bytes at @a data to @a size bytes and return the
+   *   result or return @c NULL
+   */
+  void *(*reallocate)(void *data, size_t prior, size_t size, void *context);
+
+  /// Deallocate the @a size bytes at @a data
+  void (*deallocate)(void *data, size_t size, void *context);
+
+  /// The contextual information to pass as the last argument to each function
+  void *context;
+
+  /**
+   * @brief Return the number of bytes usable at @a data which was allocated or
+   *   reallocated to @a size bytes
+   *
+   * The result must be at least @a size and it's passed as the prior size of
+   * the allocation to @a reallocate and @a deallocate from then on. This is
+   * optional and is only called when the vector's @ref vector_policy_t asks for
+   * the @ref vector_policy_t::slack of its allocations.
+   */
+  size_t (*usable)(void *data, size_t size, void *context);
+};
+
+/**
+ * @brief Return the allocator that the @a vector is bound to
+ *
+ * @return the allocator of the @a vector or @c NULL if it isn't bound to an
+ *   allocator
+ */
+inline const struct vector_allocator_t *vector_allocator(vector_c vector)
+  __attribute__((nonnull, pure));
+
+/// @cond INTERNAL
+
+/// Allocate @a size bytes with the @a allocator or with malloc()
+inline void *__vector_allocate(
+    const struct vector_allocator_t *allocator, size_t size);
+
+/// Resize the @a prior bytes at @a data to @a size bytes with the @a allocator
+/// or with realloc()
+inline void *__vector_reallocate(
+    const struct vector_allocator_t *allocator,
+    void *data,
+    size_t prior,
+    size_t size);
+
+/// Deallocate the @a size bytes at @a data with the @a allocator or with free()
+inline void __vector_deallocate(
+    const struct vector_allocator_t *allocator, void *data, size_t size);
+
+/**
+ * @brief Return the number of bytes usable at @a data which was allocated or
+ *   reallocated to @a size bytes with the @a allocator or with malloc()
+ *
+ * If the @a allocator doesn't have a @ref vector_allocator_t::usable then this
+ * is @a size. When @a allocator is @c NULL this is malloc_usable_size() (or
+ * malloc_size() on macOS) where it's available.
+ */
+inline size_t __vector_usable(
+    const struct vector_allocator_t *allocator, void *data, size_t size)
+  __attribute__((nonnull(2)));
+
+/// @endcond
+
+#ifdef VECTOR_TEST
+#undef inline
+#endif /* VECTOR_TEST */
+
+#endif /* VECTOR_ALLOCATOR_H */
+
+#ifndef VECTOR_TEST
+#include "allocator.c"
+#endif /* VECTOR_TEST */
@@ -0,0 +1,153 @@
+/// @file header/vector/arena.c
+
+#ifndef VECTOR_ARENA_C
+#define VECTOR_ARENA_C
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "arena.h"
+#include "allocator.h"
+#include "create.h"
+
+#ifdef VECTOR_TEST
+#define inline
+#endif /* VECTOR_TEST */
+
+inline struct vector_arena_t *vector_arena_create(size_t size) {
+  struct vector_arena_t *arena;
+
+  // round the size up to a multiple of the alignment of a max_align_t so that
+  // each allocation in a chunk is suitably aligned
+  if (__builtin_add_overflow(size, _Alignof(max_align_t) - 1, &size))
+    return errno = ENOMEM, NULL;
+  size &= ~(_Alignof(max_align_t) - 1);
+
+  if ((arena = malloc(sizeof(*arena))) == NULL)
+    return NULL;
+
+  arena->allocator.allocate = __vector_arena_allocate;
+  arena->allocator.reallocate = __vector_arena_reallocate;
+  arena->allocator.deallocate = __vector_arena_deallocate;
+  arena->allocator.context = arena;
+  arena->allocator.usable = NULL;
+
+  arena->chunk = NULL;
+  arena->last = NULL;
+  arena->next = NULL;
+  arena->size = size;
+  return arena;
+}
+
+inline void vector_arena_reset(struct vector_arena_t *arena) {
+  struct __vector_arena_chunk_t *chunk;
+
+  if (arena->chunk == NULL)
+    return;
+
+  // deallocate every chunk except the current one
+  while ((chunk = arena->chunk->prior) != NULL) {
+    arena->chunk->prior = chunk->prior;
+    free(chunk);
+  }
+
+  arena->last = NULL;
+  arena->next = arena->chunk->data;
+}
+
+inline void *vector_arena_delete(struct vector_arena_t *arena) {
+  struct __vector_arena_chunk_t *chunk;
+
+  while ((chunk = arena->chunk) != NULL) {
+    arena->chunk = chunk->prior;
+    free(chunk);
+  }
+
+  return free(arena), NULL;
+}
+
+inline vector_t vector_create_in(struct vector_arena_t *arena) {
+  return vector_create_using(&arena->allocator);
+}
+
+inline vector_t vector_import_in_z(
+    struct vector_arena_t *arena, const void *data, size_t length, size_t z) {
+  return vector_import_using_z(&arena->allocator, data, length, z);
+}
+
+inline void *__vector_arena_allocate(size_t size, void *context) {
+  struct vector_arena_t *arena = context;
+  struct __vector_arena_chunk_t *chunk = arena->chunk;
+
+  if (__builtin_add_overflow(size, _Alignof(max_align_t) - 1, &size))
+    return errno = ENOMEM, NULL;
+  size &= ~(_Alignof(max_align_t) - 1);
+
+  size_t room = 0;
+  if (chunk != NULL)
+    room = (size_t) (chunk->data + chunk->size - arena->next);
+
+  // if the current chunk doesn't have enough room then allocate a new one
+  if (chunk == NULL || size > room) {
+    size_t volume = size > arena->size ? size : arena->size;
+    size_t total;
+
+    if (__builtin_add_overflow(volume, sizeof(*chunk), &total))
+      return errno = ENOMEM, NULL;
+    if ((chunk = malloc(total)) == NULL)
+      return NULL;
+
+    chunk->prior = arena->chunk;
+    chunk->size = volume;
+    arena->chunk = chunk;
+    arena->next = chunk->data;
+  }
+
+  arena->last = arena->next;
+  arena->next += size;
+  return arena->last;
+}
+
+inline void *__vector_arena_reallocate(
+    void *data, size_t prior, size_t size, void *context) {
+  struct vector_arena_t *arena = context;
+  void *result;
+
+  if (data == arena->last) {
+    struct __vector_arena_chunk_t *chunk = arena->chunk;
+
+    // The room after the most recent allocation is a multiple of the alignment
+    // of a max_align_t so if size fits then size rounded up to that alignment
+    // also fits.
+    if (size <= (size_t) (chunk->data + chunk->size - arena->last)) {
+      size = (size + _Alignof(max_align_t) - 1) & ~(_Alignof(max_align_t) - 1);
+      arena->next = arena->last + size;
+      return data;
+    }
+  } else if (size <= prior)
+    return data;
+
+  if ((result = __vector_arena_allocate(size, arena)) == NULL)
+    return NULL;
+  return memcpy(result, data, prior < size ? prior : size);
+}
+
+inline void __vector_arena_deallocate(void *data, size_t size, void *context) {
+  struct vector_arena_t *arena = context;
+  (void) size;
+
+  // only the most recent allocation can be reclaimed
+  if (data == arena->last) {
+    arena->next = arena->last;
+    arena->last = NULL;
+  }
+}
+
+#ifdef VECTOR_TEST
+#undef inline
+#endif /* VECTOR_TEST */
+
+#endif /* VECTOR_ARENA_C */
@@ -0,0 +1,171 @@
+/// @file header/vector/arena.h
+
+#ifndef VECTOR_ARENA_H
+#define VECTOR_ARENA_H
+
+#include <stddef.h>
+#include "common.h"
+#include "allocator.h"
+
+#ifdef VECTOR_TEST
+#define inline
+#endif /* VECTOR_TEST */
+
+/// @cond INTERNAL
+
+/// A chunk of memory in a @ref vector_arena_t
+struct __vector_arena_chunk_t {
+  /// The chunk that was allocated before this one or @c NULL
+  struct __vector_arena_chunk_t *prior;
+  /// The size in bytes of the data in this chunk
+  size_t size;
+  _Alignas(max_align_t) char data[];
+};
+
+/// @endcond
+
+/**
+ * @brief A region of memory that vectors can be bump allocated from
+ *
+ * Each vector created in an arena (with vector_create_in() or
+ * vector_import_in()) is allocated from the arena's current chunk by simply
+ * advancing a pointer. When a vector is resized, if it's the most recent
+ * allocation in the arena and the chunk has enough room, then it's extended or
+ * contracted in place. Otherwise it's copied into a new allocation and its
+ * prior allocation is abandoned.
+ *
+ * A vector in an arena doesn't need to be deleted. Instead each vector in the
+ * arena is deallocated at once with vector_arena_reset() or
+ * vector_arena_delete(). After that any vector in the arena is invalid. If a
+ * vector in the arena is deleted with vector_delete() then its memory is only
+ * reclaimed if it's the most recent allocation in the arena.
+ *
+ * An arena isn't thread safe.
+ */
+struct vector_arena_t {
+  /// The allocator that binds a vector to this arena
+  struct vector_allocator_t allocator;
+
+  /// @cond INTERNAL
+  /// The chunk that allocations are currently made from or @c NULL
+  struct __vector_arena_chunk_t *chunk;
+  /// The most recent allocation in the current chunk or @c NULL
+  char *last;
+  /// The next available byte in the current chunk
+  char *next;
+  /// The minimum size in bytes of the data in each chunk
+  size_t size;
+  /// @endcond
+};
+
+/**
+ * @brief Allocate and initialize an empty arena
+ *
+ * The arena will allocate memory from malloc() in chunks of at least @a size
+ * bytes. No chunk is allocated until the first vector is created in the arena.
+ * On failure this will retain the value of @c errno set by malloc().
+ *
+ * @param size the minimum size in bytes of each chunk
+ * @return the new arena on success; otherwise @c NULL
+ */
+inline struct vector_arena_t *vector_arena_create(size_t size)
+  __attribute__((__malloc__));
+
+/**
+ * @brief Deallocate each vector in the @a arena
+ *
+ * The most recently allocated chunk in the @a arena is retained for reuse and
+ * every other chunk is deallocated. After this each vector in the @a arena is
+ * invalid.
+ *
+ * @param arena the arena to operate on
+ */
+inline void vector_arena_reset(struct vector_arena_t *arena)
+  __attribute__((nonnull));
+
+/**
+ * @brief Deallocate the @a arena and each vector in it and return @c NULL
+ *
+ * After this each vector in the @a arena is invalid.
+ *
+ * @param arena the arena to operate on
+ */
+inline void *vector_arena_delete(struct vector_arena_t *arena)
+  __attribute__((nonnull));
+
+/**
+ * @brief Allocate and initialize a zero length vector in the @a arena
+ *
+ * This is vector_create_using() with the allocator of the @a arena. On failure
+ * this will retain the value of @c errno set by malloc().
+ *
+ * @param arena the arena to create the vector in
+ * @return the new vector on success; otherwise @c NULL
+ */
+inline vector_t vector_create_in(struct vector_arena_t *arena)
+  __attribute__((__malloc__, nonnull));
+
+/**
+ * @brief Allocate and initialize a vector in the @a arena from @a length
+ *   elements of @a data
+ *
+ * This is vector_import_using() with the allocator of the @a arena. On failure
+ * this will retain the value of @c errno set by malloc().
+ *
+ * @param arena the arena to create the vector in
+ * @param data the data to initialize the vector from
+ * @param length the number of elements to copy from @a data
+ * @return the new vector on success; otherwise @c NULL
+ *
+ * @see vector_import_in_z() - the explicit interface analogue
+ */
+//= vector_t vector_import_in(
+//=     struct vector_arena_t *arena, const void *data, size_t length)
+#define vector_import_in(arena, data, length) \
+  vector_import_in_z((arena), (data), (length), VECTOR_Z((data)))
+
+/**
+ * @brief Allocate and initialize a vector in the @a arena from @a length
+ *   elements of @a data
+ *
+ * This is vector_import_using_z() with the allocator of the @a arena. On
+ * failure this will retain the value of @c errno set by malloc().
+ *
+ * @param arena the arena to create the vector in
+ * @param data the data to initialize the vector from
+ * @param length the number of elements to copy from @a data
+ * @param z the element size of @a data
+ * @return the new vector on success; otherwise @c NULL
+ *
+ * @see vector_import_in() - the implicit interface analogue
+ */
+inline vector_t vector_import_in_z(
+    struct vector_arena_t *arena, const void *data, size_t length, size_t z)
+  __attribute__((__malloc__, nonnull));
+
+/// @cond INTERNAL
+
+/// The @ref vector_allocator_t::allocate of a @ref vector_arena_t
+inline void *__vector_arena_allocate(size_t size, void *context)
+  __attribute__((nonnull(2)));
+
+/// The @ref vector_allocator_t::reallocate of a @ref vector_arena_t
+inline void *__vector_arena_reallocate(
+    void *data, size_t prior, size_t size, void *context)
+  __attribute__((nonnull(1, 4)));
+
+/// The @ref vector_allocator_t::deallocate of a @ref vector_arena_t
+inline void __vector_arena_deallocate(void *data, size_t size, void *context)
+  __attribute__((nonnull(1, 3)));
+
+/// @endcond
+
+#ifdef VECTOR_TEST
+#undef inline
+#endif /* VECTOR_TEST */
+
+#endif /* VECTOR_ARENA_H */
+
+#ifndef VECTOR_TEST
+#include "arena.c"
+#endif /* VECTOR_TEST */
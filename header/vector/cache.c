@@ -0,0 +1,136 @@
+/// @file header/vector/cache.c
+
+#ifndef VECTOR_CACHE_C
+#define VECTOR_CACHE_C
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "cache.h"
+
+#ifdef VECTOR_TEST
+#define inline
+#endif /* VECTOR_TEST */
+
+inline void vector_cache_flush(void) {
+  struct __vector_cache_t *cache = &__vector_cache_local;
+
+  for (size_t c = 0; c < VECTOR_CACHE_CLASS_COUNT; c++) {
+    void *data;
+    while ((data = cache->list[c]) != NULL) {
+      memcpy(&cache->list[c], data, sizeof(void *));
+      free(data);
+    }
+    cache->count[c] = 0;
+  }
+}
+
+inline struct vector_cache_stats_t vector_cache_stats(void) {
+  return __vector_cache_local.stats;
+}
+
+inline size_t __vector_cache_class(size_t size) {
+  size_t c = 0;
+  for (size_t limit = VECTOR_CACHE_MINIMUM; limit < size; limit <<= 1) {
+    if (++c == VECTOR_CACHE_CLASS_COUNT)
+      break;
+  }
+  return c;
+}
+
+inline void *__vector_cache_allocate(size_t size, void *context) {
+  struct __vector_cache_t *cache = &__vector_cache_local;
+  size_t c = __vector_cache_class(size);
+  void *data;
+  (void) context;
+
+  if (c == VECTOR_CACHE_CLASS_COUNT)
+    return cache->stats.miss++, malloc(size);
+
+  if ((data = cache->list[c]) != NULL) {
+    memcpy(&cache->list[c], data, sizeof(void *));
+    cache->count[c]--;
+    cache->stats.hit++;
+    return data;
+  }
+
+  // allocate the entire size class so that the allocation can be resized in
+  // place and retained in this size class
+  cache->stats.miss++;
+  return malloc((size_t) VECTOR_CACHE_MINIMUM << c);
+}
+
+inline void *__vector_cache_reallocate(
+    void *data, size_t prior, size_t size, void *context) {
+  struct __vector_cache_t *cache = &__vector_cache_local;
+  size_t p = __vector_cache_class(prior);
+  size_t c = __vector_cache_class(size);
+  void *result;
+
+  // neither allocation is in a size class
+  if (p == VECTOR_CACHE_CLASS_COUNT && c == VECTOR_CACHE_CLASS_COUNT)
+    return cache->stats.miss++, realloc(data, size);
+
+  // The prior allocation isn't in a size class but the new one is. Move it to
+  // an allocation of the entire size class rather than realloc() it, which may
+  // not shrink a large allocation, so that it's no larger than the size class
+  // it'll be retained in.
+  if (p == VECTOR_CACHE_CLASS_COUNT) {
+    cache->stats.miss++;
+    if ((result = malloc((size_t) VECTOR_CACHE_MINIMUM << c)) == NULL)
+      return NULL;
+    memcpy(result, data, size);
+    free(data);
+    return result;
+  }
+
+  // The allocation already has room for the entire size class of prior, so the
+  // resize can be done in place. If c < p then the allocation is larger than
+  // its new size class which is harmless.
+  if (c <= p)
+    return cache->stats.hit++, data;
+
+  if ((result = __vector_cache_allocate(size, context)) == NULL)
+    return NULL;
+  memcpy(result, data, prior < size ? prior : size);
+  __vector_cache_deallocate(data, prior, context);
+  return result;
+}
+
+inline void __vector_cache_deallocate(void *data, size_t size, void *context) {
+  struct __vector_cache_t *cache = &__vector_cache_local;
+  size_t c = __vector_cache_class(size);
+  (void) context;
+
+  // release the allocation if it isn't in a size class or if its size class is
+  // already full
+  if (c == VECTOR_CACHE_CLASS_COUNT
+      || cache->count[c] == VECTOR_CACHE_CLASS_LIMIT) {
+    cache->stats.release++;
+    free(data);
+    return;
+  }
+
+  memcpy(data, &cache->list[c], sizeof(void *));
+  cache->list[c] = data;
+  cache->count[c]++;
+  cache->stats.retain++;
+}
+
+inline size_t __vector_cache_usable(void *data, size_t size, void *context) {
+  size_t c = __vector_cache_class(size);
+  (void) data, (void) context;
+
+  // an allocation in a size class has room for the entire size class
+  if (c == VECTOR_CACHE_CLASS_COUNT)
+    return size;
+  return (size_t) VECTOR_CACHE_MINIMUM << c;
+}
+
+#ifdef VECTOR_TEST
+#undef inline
+#endif /* VECTOR_TEST */
+
+#endif /* VECTOR_CACHE_C */
@@ -0,0 +1,116 @@
+/// @file header/vector/cache.h
+
+#ifndef VECTOR_CACHE_H
+#define VECTOR_CACHE_H
+
+#include <stddef.h>
+#include "common.h"
+#include "allocator.h"
+
+#ifdef VECTOR_TEST
+#define inline
+#endif /* VECTOR_TEST */
+
+/// The size in bytes of the smallest size class in the @ref vector_cache
+#define VECTOR_CACHE_MINIMUM 64
+
+/// The number of size classes in the @ref vector_cache
+#define VECTOR_CACHE_CLASS_COUNT 5
+
+/// The number of allocations that each thread retains in each size class
+#define VECTOR_CACHE_CLASS_LIMIT 64
+
+/// The counters of a thread's @ref vector_cache
+struct vector_cache_stats_t {
+  /// The number of requests that were satisfied from the cache
+  size_t hit;
+  /// The number of requests that were passed to malloc() or realloc()
+  size_t miss;
+  /// The number of deallocations that were retained in the cache
+  size_t retain;
+  /// The number of deallocations that were passed to free()
+  size_t release;
+};
+
+/**
+ * @brief An allocator with a thread local cache of small allocations
+ *
+ * Each allocation through this allocator with a size of at most
+ * <code>VECTOR_CACHE_MINIMUM << (VECTOR_CACHE_CLASS_COUNT - 1)</code> bytes is
+ * rounded up to a power of two size class that's at least
+ * @ref VECTOR_CACHE_MINIMUM bytes. When a vector in a size class is deleted its
+ * memory is retained in a free list in the calling thread (up to
+ * @ref VECTOR_CACHE_CLASS_LIMIT in each size class) and is reused by the next
+ * allocation in that size class in that thread. In addition a resize within a
+ * vector's size class, such as the first insertion into a vector just returned
+ * by vector_create_using(), is done in place. Larger allocations are passed to
+ * malloc(), realloc(), and free().
+ *
+ * Each allocation is obtained from malloc() so a vector can be deleted in any
+ * thread. Memory retained in a thread isn't released when the thread exits
+ * unless vector_cache_flush() is called first.
+ *
+ * For example: @code{.c}
+ *   int *vector = vector_create_using(&vector_cache);
+ * @endcode
+ */
+extern const struct vector_allocator_t vector_cache;
+
+/// Deallocate each allocation retained in the calling thread's cache
+inline void vector_cache_flush(void);
+
+/**
+ * @brief Return the counters of the calling thread's cache
+ *
+ * The proportion of requests satisfied from the cache is
+ * <code>hit / (hit + miss)</code>.
+ */
+inline struct vector_cache_stats_t vector_cache_stats(void);
+
+/// @cond INTERNAL
+
+/// The state of a thread's @ref vector_cache
+struct __vector_cache_t {
+  /// The free list of each size class
+  void *list[VECTOR_CACHE_CLASS_COUNT];
+  /// The number of allocations in each free list
+  size_t count[VECTOR_CACHE_CLASS_COUNT];
+  struct vector_cache_stats_t stats;
+};
+
+/// The state of the calling thread's @ref vector_cache
+extern _Thread_local struct __vector_cache_t __vector_cache_local;
+
+/**
+ * @brief Return the size class of an allocation of @a size bytes or
+ *   @ref VECTOR_CACHE_CLASS_COUNT if it's too large to cache
+ */
+inline size_t __vector_cache_class(size_t size) __attribute__((const));
+
+/// The @ref vector_allocator_t::allocate of the @ref vector_cache
+inline void *__vector_cache_allocate(size_t size, void *context);
+
+/// The @ref vector_allocator_t::reallocate of the @ref vector_cache
+inline void *__vector_cache_reallocate(
+    void *data, size_t prior, size_t size, void *context)
+  __attribute__((nonnull(1)));
+
+/// The @ref vector_allocator_t::deallocate of the @ref vector_cache
+inline void __vector_cache_deallocate(void *data, size_t size, void *context)
+  __attribute__((nonnull(1)));
+
+/// The @ref vector_allocator_t::usable of the @ref vector_cache
+inline size_t __vector_cache_usable(void *data, size_t size, void *context)
+  __attribute__((const));
+
+/// @endcond
+
+#ifdef VECTOR_TEST
+#undef inline
+#endif /* VECTOR_TEST */
+
+#endif /* VECTOR_CACHE_H */
+
+#ifndef VECTOR_TEST
+#include "cache.c"
+#endif /* VECTOR_TEST */
@@ -3,6 +3,7 @@
 #ifndef VECTOR_COMMON_H
 #define VECTOR_COMMON_H
 
+#include <limits.h>
 #include <stddef.h>
 
 /**
@@ -58,13 +59,39 @@ inline size_t vector_length(vector_c vector) __attribute__((nonnull, pure));
  */
 #define VECTOR_Z(vector) sizeof({ __typeof__((vector)[0]) __x; __x; })
 
+struct vector_allocator_t;
+struct vector_policy_t;
+
+/// The flag of a vector whose volume isn't reduced by a removal
+#define __VECTOR_PINNED (1u << 0)
+
+/// The flag of a vector whose elements can wrap around its storage
+#define __VECTOR_RING (1u << 1)
+
 /// The header of a @ref vector_t or @ref vector_c
 struct __vector_header_t {
   size_t volume;
   size_t length;
+  /// The size in bytes of the allocation that contains this header or zero if
+  /// the header is in storage provided by the vector's creator
+  size_t size;
+  /// The allocator of the vector or @c NULL to use malloc(), etc.
+  const struct vector_allocator_t *allocator;
+  /// The policy of the vector or @c NULL to use @ref VECTOR_POLICY
+  const struct vector_policy_t *policy;
+  /// The index in the storage of the first element of the vector which is
+  /// only nonzero if the vector is a ring. This shares a word with the flags
+  /// so that the header doesn't grow past the alignment of its data.
+  size_t head : sizeof(size_t) * CHAR_BIT - 4;
+  /// A combination of the __VECTOR_* flags of the vector
+  size_t flags : 4;
   _Alignas(max_align_t) char data[];
 };
 
+/// The largest volume of a ring such that the index of any element in its
+/// storage fits in the head of its header
+#define __VECTOR_RING_VOLUME_MAX ((size_t) 1 << (sizeof(size_t) * CHAR_BIT - 4))
+
 /**
  * @brief Return the header associated with the @a vector
  *
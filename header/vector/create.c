@@ -5,39 +5,75 @@
 
 #include <errno.h>
 #include <stddef.h>
-#include <stdlib.h>
 #include <string.h>
 
 #include "common.h"
 #include "create.h"
+#include "allocator.h"
 
 #ifdef VECTOR_TEST
 #define inline
 #endif /* VECTOR_TEST */
 
 inline vector_t vector_create(void) {
+  return vector_create_using(NULL);
+}
+
+inline vector_t vector_create_using(
+    const struct vector_allocator_t *allocator) {
   struct __vector_header_t *header;
 
-  if ((header = malloc(sizeof(*header))) == NULL)
+  if ((header = __vector_allocate(allocator, sizeof(*header))) == NULL)
     return NULL;
 
   header->volume = 0;
   header->length = 0;
+  header->size = sizeof(*header);
+  header->allocator = allocator;
+  header->policy = NULL;
+  header->head = 0;
+  header->flags = 0;
+  return header->data;
+}
+
+inline vector_t vector_create_inline_z(void *storage, size_t size, size_t z) {
+  struct __vector_header_t *header = storage;
+
+  header->volume = (size - sizeof(*header)) / z;
+  header->length = 0;
+  header->size = 0;
+  header->allocator = NULL;
+  header->policy = NULL;
+  header->head = 0;
+  header->flags = 0;
   return header->data;
 }
 
 inline vector_t vector_import_z(const void *data, size_t length, size_t z) {
+  return vector_import_using_z(NULL, data, length, z);
+}
+
+inline vector_t vector_import_using_z(
+    const struct vector_allocator_t *allocator,
+    const void *data,
+    size_t length,
+    size_t z) {
   struct __vector_header_t *header;
 
   // Doesn't overflow because this is the size of data
   size_t size = length * z;
   if (__builtin_add_overflow(size, sizeof(*header), &size))
     return errno = ENOMEM, NULL;
-  if ((header = malloc(size)) == NULL)
+  if ((header = __vector_allocate(allocator, size)) == NULL)
     return NULL;
 
   header->volume = length;
   header->length = length;
+  header->size = size;
+  header->allocator = allocator;
+  header->policy = NULL;
+  header->head = 0;
+  header->flags = 0;
   return memcpy(header->data, data, length * z);
 }
 
@@ -19,6 +19,20 @@
  */
 inline vector_t vector_create(void) __attribute__((__malloc__));
 
+/**
+ * @brief Allocate and initialize a zero length vector bound to the @a allocator
+ *
+ * The vector will be allocated, resized, and deallocated through the
+ * @a allocator for its entire lifetime. If @a allocator is @c NULL then this is
+ * identical to vector_create(). On failure this will retain the value of
+ * @c errno set by the @a allocator.
+ *
+ * @param allocator the allocator to bind the vector to or @c NULL
+ * @return the new vector on success; otherwise @c NULL
+ */
+inline vector_t vector_create_using(const struct vector_allocator_t *allocator)
+  __attribute__((__malloc__));
+
 /**
  * @brief Allocate and initialize a vector from @a length elements of @a data
  *
@@ -51,6 +65,122 @@ inline vector_t vector_create(void) __attribute__((__malloc__));
 inline vector_t vector_import_z(const void *data, size_t length, size_t z)
   __attribute__((__malloc__, nonnull));
 
+/**
+ * @brief Allocate and initialize a vector bound to the @a allocator from
+ *   @a length elements of @a data
+ *
+ * This is vector_import() except that the vector will be allocated, resized,
+ * and deallocated through the @a allocator for its entire lifetime. If
+ * @a allocator is @c NULL then this is identical to vector_import(). On failure
+ * this will retain the value of @c errno set by the @a allocator.
+ *
+ * @param allocator the allocator to bind the vector to or @c NULL
+ * @param data the data to initialize the vector from
+ * @param length the number of elements to copy from @a data
+ * @return the new vector on success; otherwise @c NULL
+ *
+ * @see vector_import_using_z() - the explicit interface analogue
+ */
+//= vector_t vector_import_using(
+//=     const struct vector_allocator_t *allocator,
+//=     const void *data,
+//=     size_t length)
+#define vector_import_using(allocator, data, length) \
+  vector_import_using_z((allocator), (data), (length), VECTOR_Z((data)))
+
+/**
+ * @brief Allocate and initialize a vector bound to the @a allocator from
+ *   @a length elements of @a data
+ *
+ * This is vector_import_z() except that the vector will be allocated, resized,
+ * and deallocated through the @a allocator for its entire lifetime. If
+ * @a allocator is @c NULL then this is identical to vector_import_z(). On
+ * failure this will retain the value of @c errno set by the @a allocator.
+ *
+ * @param allocator the allocator to bind the vector to or @c NULL
+ * @param data the data to initialize the vector from
+ * @param length the number of elements to copy from @a data
+ * @param z the element size of @a data
+ * @return the new vector on success; otherwise @c NULL
+ *
+ * @see vector_import_using() - the implicit interface analogue
+ */
+inline vector_t vector_import_using_z(
+    const struct vector_allocator_t *allocator,
+    const void *data,
+    size_t length,
+    size_t z)
+  __attribute__((__malloc__, nonnull(2)));
+
+/**
+ * @brief The type of storage for a vector of up to @a volume elements of
+ *   @a type
+ *
+ * An object of this type can be declared on the stack or embedded in a struct
+ * and passed to vector_create_inline_z() to create a vector in it. For example:
+ * @code{.c}
+ *   vector_storage(int, 8) storage;
+ *   int *vector =
+ *     vector_create_inline_z(&storage, sizeof(storage), sizeof(int));
+ * @endcode
+ *
+ * @param type a complete object type
+ * @param volume the number of elements of @a type to accomodate
+ */
+#define vector_storage(type, volume) union { \
+  max_align_t __align; \
+  char __data[sizeof(struct __vector_header_t) + sizeof(type) * (volume)]; \
+}
+
+/**
+ * @brief Initialize a zero length vector in @a size bytes of @a storage
+ *
+ * The vector is created in the @a storage without an allocation. Its volume is
+ * the number of elements that fit in the @a storage after the vector's header.
+ * So long as its volume doesn't need to increase the vector behaves like any
+ * other vector without a reallocation. A resize to a lower volume (such as by
+ * vector_remove_z() or vector_shrink_z()) retains the @a storage and its
+ * volume.
+ *
+ * Once an increase in its volume is needed, the vector is moved into a new
+ * allocation from malloc() and from then on behaves like a vector created with
+ * vector_create(). The @a storage itself is never resized or deallocated, but
+ * vector_delete() should still be called on the vector in case it's been moved.
+ *
+ * The @a storage must be aligned to a @c max_align_t and must outlive the
+ * vector while it's in the @a storage. If @a size is less than the size of the
+ * header of a vector or @a z is zero then the behavior is undefined. Storage of
+ * the right size and alignment can be declared with vector_storage().
+ *
+ * @param storage the storage to create the vector in
+ * @param size the size in bytes of the @a storage
+ * @param z the element size of the vector, which must not be zero
+ * @return the new vector
+ */
+inline vector_t vector_create_inline_z(void *storage, size_t size, size_t z)
+  __attribute__((nonnull, returns_nonnull));
+
+/**
+ * @brief Create a zero length vector of @a type in storage for @a volume
+ *   elements in the enclosing block
+ *
+ * This is vector_create_inline_z() with storage from vector_storage() declared
+ * as a compound literal. As a result the storage has automatic storage
+ * duration associated with the enclosing block of the expansion. For example:
+ * @code{.c}
+ *   int *vector = vector_inline(int, 8);
+ * @endcode
+ *
+ * @param type a complete object type
+ * @param volume the number of elements of @a type to accomodate
+ * @return the new vector
+ */
+#define vector_inline(type, volume) \
+  ((__typeof__(type) *) vector_create_inline_z( \
+    (vector_storage(type, volume)) { 0 }.__data, \
+    sizeof(vector_storage(type, volume)), \
+    sizeof(type)))
+
 /**
  * @brief Allocate and initialize a vector from the argument list
  *
@@ -3,17 +3,21 @@
 #ifndef VECTOR_DELETE_C
 #define VECTOR_DELETE_C
 
-#include <stdlib.h>
-
 #include "common.h"
 #include "delete.h"
+#include "allocator.h"
 
 #ifdef VECTOR_TEST
 #define inline
 #endif /* VECTOR_TEST */
 
 inline void *vector_delete(vector_t vector) {
-  return free(__vector_to_header(vector)), NULL;
+  struct __vector_header_t *header = __vector_to_header(vector);
+
+  // the vector isn't in an allocation if it's in storage from its creator
+  if (header->size != 0)
+    __vector_deallocate(header->allocator, header, header->size);
+  return NULL;
 }
 
 #ifdef VECTOR_TEST
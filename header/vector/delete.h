@@ -9,7 +9,12 @@
 #define inline
 #endif /* VECTOR_TEST */
 
-/// Deallocate the @a vector and return @c NULL
+/**
+ * @brief Deallocate the @a vector and return @c NULL
+ *
+ * If the @a vector is in storage provided to vector_create_inline_z() then the
+ * storage isn't deallocated.
+ */
 inline void *vector_delete(vector_t vector);
 
 #ifdef VECTOR_TEST
@@ -0,0 +1,132 @@
+/// @file header/vector/eytzinger.c
+
+#ifndef VECTOR_EYTZINGER_C
+#define VECTOR_EYTZINGER_C
+
+#include <errno.h>
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "common.h"
+#include "eytzinger.h"
+#include "access.h"
+#include "allocator.h"
+
+#ifdef VECTOR_TEST
+#define inline
+#endif /* VECTOR_TEST */
+
+inline vector_t vector_eytzinger_z(vector_c vector, size_t z) {
+  struct __vector_header_t *header;
+  size_t n = vector_length(vector);
+
+  // allocate the header and exactly the volume once. The data doesn't overflow
+  // because it's the size of the vector.
+  size_t size = n * z;
+  if (__builtin_add_overflow(size, sizeof(*header), &size))
+    return errno = ENOMEM, NULL;
+  if ((header = __vector_allocate(NULL, size)) == NULL)
+    return NULL;
+
+  header->volume = n;
+  header->length = n;
+  header->size = size;
+  header->allocator = NULL;
+  header->policy = NULL;
+  header->head = 0;
+  header->flags = 0;
+
+  // write the layout in order and read each element from its rank
+  for (size_t k = 1; k <= n; k++) {
+    const void *source = vector_at(vector, __vector_eytzinger_rank(k, n), z);
+    memcpy(header->data + (k - 1) * z, source, z);
+  }
+
+  return header->data;
+}
+
+inline size_t vector_eytzinger_lower_bound_z(
+    vector_c layout,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b),
+    size_t z) {
+  size_t n = vector_length(layout);
+  size_t k = __vector_eytzinger_bound_z(layout, elmt, cmpf, 0, z);
+  return k == 0 ? n : __vector_eytzinger_rank(k, n);
+}
+
+inline size_t vector_eytzinger_upper_bound_z(
+    vector_c layout,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b),
+    size_t z) {
+  size_t n = vector_length(layout);
+  size_t k = __vector_eytzinger_bound_z(layout, elmt, cmpf, 1, z);
+  return k == 0 ? n : __vector_eytzinger_rank(k, n);
+}
+
+inline size_t vector_eytzinger_search_z(
+    vector_c layout,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b),
+    size_t z) {
+  size_t k = __vector_eytzinger_bound_z(layout, elmt, cmpf, 0, z);
+
+  if (k == 0 || cmpf(elmt, vector_at(layout, k - 1, z)) != 0)
+    return SIZE_MAX;
+  return __vector_eytzinger_rank(k, vector_length(layout));
+}
+
+inline size_t __vector_eytzinger_rank(size_t k, size_t n) {
+  const int bits = sizeof(size_t) * CHAR_BIT;
+
+  // the depth of position k and of the last (possibly partial) level
+  int d = bits - 1 - __builtin_clzl(k);
+  int h = bits - 1 - __builtin_clzl(n);
+
+  // Its index if the last level were full: the nodes of the last level are
+  // every other node in order and each node above is at the middle of its
+  // subtree.
+  size_t rank = ((2 * (k - ((size_t) 1 << d)) + 1) << (h - d)) - 1;
+
+  // less each missing node of the last level before it in order
+  size_t m = n - (((size_t) 1 << h) - 1);
+  size_t before = (rank + 1) / 2;
+  return before > m ? rank - (before - m) : rank;
+}
+
+inline size_t __vector_eytzinger_bound_z(
+    vector_c layout,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b),
+    _Bool upper,
+    size_t z) {
+  // position k is at base + k * z
+  const char *base = (const char *) layout - z;
+  size_t n = vector_length(layout);
+  size_t k = 1;
+
+  // Descend the tree to the right of each element before the bound and to the
+  // left of each after it. The 16 descendants of k four levels down are
+  // adjacent, so prefetch them while the four levels in between are compared.
+  while (k <= n) {
+    if (16 * k + 15 <= n) {
+      __builtin_prefetch(base + 16 * k * z);
+      __builtin_prefetch(base + (16 * k + 15) * z);
+    }
+    int c = cmpf(elmt, base + k * z);
+    k = 2 * k + (upper ? c >= 0 : c > 0);
+  }
+
+  // The bound is where the descent last went left. Each right since then is a
+  // trailing one of k and the left is the zero before them.
+  return k >> (__builtin_ctzl(~k) + 1);
+}
+
+#ifdef VECTOR_TEST
+#undef inline
+#endif /* VECTOR_TEST */
+
+#endif /* VECTOR_EYTZINGER_C */
@@ -0,0 +1,271 @@
+/// @file header/vector/eytzinger.h
+
+#ifndef VECTOR_EYTZINGER_H
+#define VECTOR_EYTZINGER_H
+
+#include <stddef.h>
+
+#include "common.h"
+
+#ifdef VECTOR_TEST
+#define inline
+#endif /* VECTOR_TEST */
+
+/// @addtogroup vector_module Vector
+/// @{
+/// @name Eytzinger Layout
+/// @{
+
+/**
+ * @brief Allocate a copy of the sorted @a vector in Eytzinger order
+ *
+ * In Eytzinger order the elements are stored as the nodes of a complete
+ * binary search tree in breadth first order: the root is at index 0 and the
+ * children of the node at index <code>k - 1</code> are at indices
+ * <code>2k - 1</code> and @c 2k. A binary search of this layout reads the
+ * first few levels of the tree from the same cache lines on every search,
+ * and the descendants of a node a few levels down are adjacent so they can be
+ * prefetched together. On a large @a vector this makes a search far less
+ * bound by the latency of memory than a binary search of the @a vector.
+ *
+ * The layout is a vector with the same element type and length as the
+ * @a vector. It should be searched only with vector_eytzinger_lower_bound(),
+ * vector_eytzinger_upper_bound() and vector_eytzinger_search(), which return
+ * indices in the sorted @a vector. It's a copy, so it must be rebuilt if the
+ * @a vector is modified.
+ *
+ * If the allocation fails then this will return @c NULL and the value of
+ * @c errno set by malloc() will be retained.
+ *
+ * @param vector the sorted vector to copy
+ * @return the layout on success; otherwise @c NULL
+ *
+ * @see vector_eytzinger_z() - the explicit interface analogue
+ */
+//= vector_t vector_eytzinger(vector_c vector)
+#define vector_eytzinger(v) vector_eytzinger_z((v), VECTOR_Z((v)))
+
+/**
+ * @brief Allocate a copy of the sorted @a vector in Eytzinger order
+ *
+ * See vector_eytzinger() for a description of the layout.
+ *
+ * If the allocation fails then this will return @c NULL and the value of
+ * @c errno set by malloc() will be retained.
+ *
+ * @param vector the sorted vector to copy
+ * @param z the element size of the @a vector
+ * @return the layout on success; otherwise @c NULL
+ *
+ * @see vector_eytzinger() - the implicit interface analogue
+ */
+inline vector_t vector_eytzinger_z(vector_c vector, size_t z)
+  __attribute__((nonnull, warn_unused_result));
+
+/**
+ * @brief Find the index of the first element in the sorted vector of the
+ *   @a layout that doesn't compare less than @a elmt
+ *
+ * This is vector_lower_bound() on the sorted vector that the @a layout was
+ * built from by vector_eytzinger(), but it returns the same index while
+ * touching far fewer cache lines.
+ *
+ * The @a cmpf is called with @a elmt as @a a and an element of the @a layout as
+ * @a b. If the vector that the @a layout was built from isn't partitioned with
+ * respect to @a elmt according to @a cmpf, as in vector_lower_bound(), then the
+ * behavior is undefined.
+ *
+ * @param layout the layout to search
+ * @param elmt the element to search for
+ * @param cmpf the function to use to compare elements
+ * @return the index of the element, or the length of the @a layout
+ *
+ * @see vector_eytzinger_lower_bound_z() - the explicit interface analogue
+ */
+//= size_t vector_eytzinger_lower_bound(
+//=     vector_c layout,
+//=     const void *elmt,
+//=     int (*cmpf)(const void *a, const void *b))
+#define vector_eytzinger_lower_bound(v, ...) \
+  vector_eytzinger_lower_bound_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Find the index of the first element in the sorted vector of the
+ *   @a layout that doesn't compare less than @a elmt
+ *
+ * This is vector_lower_bound() on the sorted vector that the @a layout was
+ * built from by vector_eytzinger(), but it returns the same index while
+ * touching far fewer cache lines.
+ *
+ * The @a cmpf is called with @a elmt as @a a and an element of the @a layout as
+ * @a b. If the vector that the @a layout was built from isn't partitioned with
+ * respect to @a elmt according to @a cmpf, as in vector_lower_bound(), then the
+ * behavior is undefined.
+ *
+ * @param layout the layout to search
+ * @param elmt the element to search for
+ * @param cmpf the function to use to compare elements
+ * @param z the element size of the @a layout
+ * @return the index of the element, or the length of the @a layout
+ *
+ * @see vector_eytzinger_lower_bound() - the implicit interface analogue
+ */
+inline size_t vector_eytzinger_lower_bound_z(
+    vector_c layout,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b),
+    size_t z)
+  __attribute__((nonnull(1, 3), pure));
+
+/**
+ * @brief Find the index of the first element in the sorted vector of the
+ *   @a layout that compares greater than @a elmt
+ *
+ * This is vector_upper_bound() on the sorted vector that the @a layout was
+ * built from by vector_eytzinger(), but it returns the same index while
+ * touching far fewer cache lines.
+ *
+ * The @a cmpf is called with @a elmt as @a a and an element of the @a layout as
+ * @a b. If the vector that the @a layout was built from isn't partitioned with
+ * respect to @a elmt according to @a cmpf, as in vector_lower_bound(), then the
+ * behavior is undefined.
+ *
+ * @param layout the layout to search
+ * @param elmt the element to search for
+ * @param cmpf the function to use to compare elements
+ * @return the index of the element, or the length of the @a layout
+ *
+ * @see vector_eytzinger_upper_bound_z() - the explicit interface analogue
+ */
+//= size_t vector_eytzinger_upper_bound(
+//=     vector_c layout,
+//=     const void *elmt,
+//=     int (*cmpf)(const void *a, const void *b))
+#define vector_eytzinger_upper_bound(v, ...) \
+  vector_eytzinger_upper_bound_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Find the index of the first element in the sorted vector of the
+ *   @a layout that compares greater than @a elmt
+ *
+ * This is vector_upper_bound() on the sorted vector that the @a layout was
+ * built from by vector_eytzinger(), but it returns the same index while
+ * touching far fewer cache lines.
+ *
+ * The @a cmpf is called with @a elmt as @a a and an element of the @a layout as
+ * @a b. If the vector that the @a layout was built from isn't partitioned with
+ * respect to @a elmt according to @a cmpf, as in vector_lower_bound(), then the
+ * behavior is undefined.
+ *
+ * @param layout the layout to search
+ * @param elmt the element to search for
+ * @param cmpf the function to use to compare elements
+ * @param z the element size of the @a layout
+ * @return the index of the element, or the length of the @a layout
+ *
+ * @see vector_eytzinger_upper_bound() - the implicit interface analogue
+ */
+inline size_t vector_eytzinger_upper_bound_z(
+    vector_c layout,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b),
+    size_t z)
+  __attribute__((nonnull(1, 3), pure));
+
+/**
+ * @brief Find the index of the first element in the sorted vector of the
+ *   @a layout equal to @a elmt
+ *
+ * This is vector_search() on the sorted vector that the @a layout was built
+ * from by vector_eytzinger(), but it returns the same index while touching far
+ * fewer cache lines. If no element is equal to @a elmt then this will return
+ * @c SIZE_MAX.
+ *
+ * The @a cmpf is called with @a elmt as @a a and an element of the @a layout as
+ * @a b. If the vector that the @a layout was built from isn't partitioned with
+ * respect to @a elmt according to @a cmpf, as in vector_lower_bound(), then the
+ * behavior is undefined.
+ *
+ * @param layout the layout to search
+ * @param elmt the element to search for
+ * @param cmpf the function to use to compare elements
+ * @return the index of the element on success; otherwise @c SIZE_MAX
+ *
+ * @see vector_eytzinger_search_z() - the explicit interface analogue
+ */
+//= size_t vector_eytzinger_search(
+//=     vector_c layout,
+//=     const void *elmt,
+//=     int (*cmpf)(const void *a, const void *b))
+#define vector_eytzinger_search(v, ...) \
+  vector_eytzinger_search_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Find the index of the first element in the sorted vector of the
+ *   @a layout equal to @a elmt
+ *
+ * This is vector_search() on the sorted vector that the @a layout was built
+ * from by vector_eytzinger(), but it returns the same index while touching far
+ * fewer cache lines. If no element is equal to @a elmt then this will return
+ * @c SIZE_MAX.
+ *
+ * The @a cmpf is called with @a elmt as @a a and an element of the @a layout as
+ * @a b. If the vector that the @a layout was built from isn't partitioned with
+ * respect to @a elmt according to @a cmpf, as in vector_lower_bound(), then the
+ * behavior is undefined.
+ *
+ * @param layout the layout to search
+ * @param elmt the element to search for
+ * @param cmpf the function to use to compare elements
+ * @param z the element size of the @a layout
+ * @return the index of the element on success; otherwise @c SIZE_MAX
+ *
+ * @see vector_eytzinger_search() - the implicit interface analogue
+ */
+inline size_t vector_eytzinger_search_z(
+    vector_c layout,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b),
+    size_t z)
+  __attribute__((nonnull(1, 3), pure));
+
+/// @cond INTERNAL
+
+/**
+ * @brief Return the index in the sorted vector of the element at position @a k
+ *   of a layout of @a n elements
+ *
+ * A position is one more than an index in the layout, so the root is at
+ * position 1 and the children of position @a k are at @c 2k and
+ * <code>2k + 1</code>.
+ */
+inline size_t __vector_eytzinger_rank(size_t k, size_t n)
+  __attribute__((const));
+
+/**
+ * @brief Return the position of the first element in the @a layout that
+ *   compares greater than (or if @a upper is false, not less than) @a elmt, or
+ *   zero if there's no such element
+ */
+inline size_t __vector_eytzinger_bound_z(
+    vector_c layout,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b),
+    _Bool upper,
+    size_t z)
+  __attribute__((nonnull(1, 3), pure));
+
+/// @endcond
+
+#ifdef VECTOR_TEST
+#undef inline
+#endif /* VECTOR_TEST */
+
+/// @}
+/// @}
+
+#endif /* VECTOR_EYTZINGER_H */
+
+#ifndef VECTOR_TEST
+#include "eytzinger.c"
+#endif /* VECTOR_TEST */
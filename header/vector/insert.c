@@ -10,7 +10,11 @@
 #include "common.h"
 #include "insert.h"
 #include "access.h"
+#include "allocator.h"
+#include "remove.h"
 #include "resize.h"
+#include "ring.h"
+#include "stats.h"
 
 #ifdef VECTOR_TEST
 #define inline
@@ -43,6 +47,7 @@ inline vector_t vector_inject_z(
   void *source = vector_at(vector, i + 0, z);
   size_t size = (vector_length(vector) - i) * z;
   memmove(target, source, size);
+  __vector_stats_add(move_bytes, size);
 
   if (elmt != NULL)
     memcpy(vector_at(vector, i, z), elmt, n * z);
@@ -57,6 +62,8 @@ inline vector_t vector_append_z(
     restrict vector_t vector,
     const void *restrict elmt,
     size_t z) {
+  if (vector_ringed(vector))
+    return __vector_ring_push_z(vector, elmt, z);
   return vector_inject_z(vector, vector_length(vector), elmt, 1, z);
 }
 
@@ -68,6 +75,180 @@ inline vector_t vector_extend_z(
   return vector_inject_z(vector, vector_length(vector), elmt, n, z);
 }
 
+inline vector_t vector_extend_many_z(
+    restrict vector_t vector,
+    const vector_c *srcs,
+    size_t count,
+    size_t z) {
+  size_t length = vector_length(vector);
+
+  for (size_t k = 0; k < count; k++)
+    if (__builtin_add_overflow(length, vector_length(srcs[k]), &length))
+      return errno = ENOMEM, NULL;
+
+  if ((vector = vector_ensure_z(vector, length, z)) == NULL)
+    return NULL;
+
+  // copy each vector to the tail in turn
+  char *tail = vector_at(vector, vector_length(vector), z);
+  for (size_t k = 0; k < count; k++) {
+    size_t size = vector_length(srcs[k]) * z;
+    memcpy(tail, srcs[k], size);
+    tail += size;
+  }
+
+  // increase the length
+  __vector_to_header(vector)->length = length;
+
+  return vector;
+}
+
+inline vector_t vector_concat_z(
+    const vector_c *vectors, size_t count, size_t z) {
+  struct __vector_header_t *header;
+  size_t length = 0, size;
+
+  for (size_t k = 0; k < count; k++)
+    if (__builtin_add_overflow(length, vector_length(vectors[k]), &length))
+      return errno = ENOMEM, NULL;
+
+  // allocate the header and exactly the volume once
+  if (__builtin_mul_overflow(length, z, &size))
+    return errno = ENOMEM, NULL;
+  if (__builtin_add_overflow(size, sizeof(*header), &size))
+    return errno = ENOMEM, NULL;
+  if ((header = __vector_allocate(NULL, size)) == NULL)
+    return NULL;
+
+  header->volume = length;
+  header->length = length;
+  header->size = size;
+  header->allocator = NULL;
+  header->policy = NULL;
+  header->head = 0;
+  header->flags = 0;
+
+  // copy each vector in turn
+  char *data = header->data;
+  for (size_t k = 0; k < count; k++) {
+    size_t n = vector_length(vectors[k]) * z;
+    memcpy(data, vectors[k], n);
+    data += n;
+  }
+
+  return header->data;
+}
+
+inline vector_t vector_insert_many_z(
+    restrict vector_t vector,
+    const size_t *index,
+    const void *restrict elmt,
+    size_t n,
+    size_t z) {
+  size_t length = vector_length(vector);
+  size_t tail = length;
+
+  if (__builtin_add_overflow(length, n, &length))
+    return errno = ENOMEM, NULL;
+
+  if ((vector = vector_ensure_z(vector, length, z)) == NULL)
+    return NULL;
+
+  // From the tail to the head, move each run of existing elements between two
+  // insertions j elements toward the tail and then insert the element before
+  // it. As each run is moved toward the tail it never overlaps a run that
+  // hasn't been moved yet.
+  for (size_t j = n; j-- > 0; ) {
+    void *target = vector_at(vector, index[j] + j + 1, z);
+    void *source = vector_at(vector, index[j], z);
+    size_t size = (tail - index[j]) * z;
+    memmove(target, source, size);
+    __vector_stats_add(move_bytes, size);
+
+    if (elmt != NULL) {
+      target = vector_at(vector, index[j] + j, z);
+      memcpy(target, (const char *) elmt + j * z, z);
+    }
+    tail = index[j];
+  }
+
+  // increase the length
+  __vector_to_header(vector)->length = length;
+
+  return vector;
+}
+
+inline vector_t vector_swap_insert_z(
+    restrict vector_t vector,
+    size_t i,
+    const void *restrict elmt,
+    size_t z) {
+  size_t length = vector_length(vector);
+
+  if (__builtin_add_overflow(length, 1, &length))
+    return errno = ENOMEM, NULL;
+
+  if ((vector = vector_ensure_z(vector, length, z)) == NULL)
+    return NULL;
+
+  // move the element at i to the tail
+  if (i != length - 1)
+    memcpy(vector_at(vector, length - 1, z), vector_at(vector, i, z), z);
+
+  if (elmt != NULL)
+    memcpy(vector_at(vector, i, z), elmt, z);
+
+  // increase the length
+  __vector_to_header(vector)->length = length;
+
+  return vector;
+}
+
+inline vector_t vector_replace_z(
+    restrict vector_t vector,
+    size_t i,
+    size_t n,
+    const void *restrict elmt,
+    size_t m,
+    size_t z) {
+  const char *data = elmt;
+
+  // Shift the tail once by the difference in length and then overwrite the
+  // rest of the range. When shrinking the excise contracts the vector after
+  // its elements are shifted, and when growing the inject ensures it first.
+  if (m < n) {
+    vector = vector_excise_z(vector, i + m, n - m, z);
+  } else if (m > n) {
+    const void *rest = data == NULL ? NULL : data + n * z;
+    if ((vector = vector_inject_z(vector, i + n, rest, m - n, z)) == NULL)
+      return NULL;
+    m = n;
+  }
+
+  if (data != NULL)
+    memcpy(vector_at(vector, i, z), data, m * z);
+
+  return vector;
+}
+
+inline vector_t vector_splice_z(
+    vector_t dst,
+    size_t di,
+    vector_t *src,
+    size_t si,
+    size_t n,
+    size_t z) {
+  // ensure and shift dst once and then copy the range straight into the gap
+  dst = vector_inject_z(dst, di, vector_at(*src, si, z), n, z);
+  if (dst == NULL)
+    return NULL;
+
+  // shift and contract the source once
+  *src = vector_excise_z(*src, si, n, z);
+
+  return dst;
+}
+
 #ifdef VECTOR_TEST
 #undef inline
 #endif /* VECTOR_TEST */
@@ -244,6 +244,430 @@ inline vector_t vector_extend_z(
     size_t z)
   __attribute__((nonnull(1), warn_unused_result));
 
+/**
+ * @brief Append the elements of each of @a count vectors in @a srcs to the tail
+ *   of the @a vector
+ *
+ * The lengths of the vectors in @a srcs are summed so that the @a vector is
+ * ensured to accomodate all of their elements once, and then each of them is
+ * copied to the tail in order. This is much faster than @a count calls to
+ * vector_extend() when the vectors are many or large, since the @a vector
+ * isn't reallocated (and copied) once per vector as it grows.
+ *
+ * If the resultant length of the @a vector would overflow a @c size_t then this
+ * will set @c errno to @c ENOMEM and return @c NULL. Otherwise this will call
+ * vector_ensure(). If that fails then the @a vector will be unmodified and
+ * the value of @c errno set by realloc() will be retained.
+ *
+ * If the element type of any vector in @a srcs is incompatible with the
+ * element type of the @a vector then the behavior is undefined. If the
+ * @a vector itself is in @a srcs, or any vector in @a srcs is a ring, then the
+ * behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param srcs the vectors to append the elements of
+ * @param count the number of vectors in @a srcs
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_extend_many_z() - the explicit interface analogue
+ */
+//= inline vector_t vector_extend_many(
+//=     restrict vector_t vector, const vector_c *srcs, size_t count)
+#define vector_extend_many(v, s, ...) \
+  vector_extend_many_z((v), (const vector_c *) (s), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Append the elements of each of @a count vectors in @a srcs to the tail
+ *   of the @a vector
+ *
+ * The lengths of the vectors in @a srcs are summed so that the @a vector is
+ * ensured to accomodate all of their elements once, and then each of them is
+ * copied to the tail in order. This is much faster than @a count calls to
+ * vector_extend_z() when the vectors are many or large, since the @a vector
+ * isn't reallocated (and copied) once per vector as it grows.
+ *
+ * If the resultant length of the @a vector would overflow a @c size_t then this
+ * will set @c errno to @c ENOMEM and return @c NULL. Otherwise this will call
+ * vector_ensure_z(). If that fails then the @a vector will be unmodified and
+ * the value of @c errno set by realloc() will be retained.
+ *
+ * If the element type of any vector in @a srcs is incompatible with the
+ * element type of the @a vector then the behavior is undefined. If the
+ * @a vector itself is in @a srcs, or any vector in @a srcs is a ring, then the
+ * behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param srcs the vectors to append the elements of
+ * @param count the number of vectors in @a srcs
+ * @param z the element size of the @a vector
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_extend_many() - the implicit interface analogue
+ */
+inline vector_t vector_extend_many_z(
+    restrict vector_t vector,
+    const vector_c *srcs,
+    size_t count,
+    size_t z)
+  __attribute__((nonnull(1), warn_unused_result));
+
+/**
+ * @brief Allocate and initialize a vector from the elements of each of
+ *   @a count vectors in @a vectors
+ *
+ * The resultant vector is allocated once with a volume of exactly the sum of
+ * the lengths of the vectors, and the elements of each of them are copied into
+ * it in order. If @a count is zero then the resultant vector is empty.
+ *
+ * If the sum of the lengths of the vectors would overflow a @c size_t then this
+ * will set @c errno to @c ENOMEM and return @c NULL. If the allocation fails
+ * then the value of @c errno set by realloc() will be retained.
+ *
+ * If the element types of the vectors in @a vectors aren't all compatible
+ * then the behavior is undefined. If any vector in @a vectors is a ring
+ * then the behavior is undefined.
+ *
+ * @param vectors the vectors to concatenate the elements of
+ * @param count the number of vectors in @a vectors
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_concat_z() - the explicit interface analogue
+ */
+//= inline vector_t vector_concat(const vector_c *vectors, size_t count)
+#define vector_concat(vs, ...) \
+  vector_concat_z((const vector_c *) (vs), __VA_ARGS__, VECTOR_Z((vs)[0]))
+
+/**
+ * @brief Allocate and initialize a vector from the elements of each of
+ *   @a count vectors in @a vectors
+ *
+ * The resultant vector is allocated once with a volume of exactly the sum of
+ * the lengths of the vectors, and the elements of each of them are copied into
+ * it in order. If @a count is zero then the resultant vector is empty.
+ *
+ * If the sum of the lengths of the vectors would overflow a @c size_t then this
+ * will set @c errno to @c ENOMEM and return @c NULL. If the allocation fails
+ * then the value of @c errno set by realloc() will be retained.
+ *
+ * If the element types of the vectors in @a vectors aren't all compatible with
+ * an element size of @a z then the behavior is undefined. If any vector in
+ * @a vectors is a ring then the behavior is undefined.
+ *
+ * @param vectors the vectors to concatenate the elements of
+ * @param count the number of vectors in @a vectors
+ * @param z the element size of the vectors
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_concat() - the implicit interface analogue
+ */
+inline vector_t vector_concat_z(
+    const vector_c *vectors, size_t count, size_t z)
+  __attribute__((warn_unused_result));
+
+/**
+ * @brief Insert each of @a n elements from @a elmt into the @a vector before
+ *   the element at the corresponding index in @a index
+ *
+ * Each index in @a index is an index in the @a vector before any insertion (or
+ * its length to append) and must be no less than the index before it. The
+ * element <code>elmt[j]</code> is inserted before the element at
+ * <code>index[j]</code> so that its index in the resultant vector is
+ * <code>index[j] + j</code>. Elements with the same index are inserted in the
+ * order that they're in @a elmt. If @a elmt is @c NULL then the inserted
+ * elements will be uninitialized.
+ *
+ * This resizes the @a vector at most once and moves each existing element at
+ * most once, from the tail to the head, so it's much faster than @a n calls to
+ * vector_insert() when @a n is large.
+ *
+ * If the resultant length of the @a vector would overflow a @c size_t then this
+ * will set @c errno to @c ENOMEM and return @c NULL. Otherwise this will call
+ * vector_ensure(). If that fails then the @a vector will be unmodified and the
+ * value of @c errno set by realloc() will be retained.
+ *
+ * If @a index isn't sorted or any index in it is greater than the length of
+ * the @a vector then the behavior is undefined. If @a elmt is a location in the
+ * @a vector itself then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param index the sorted indices in the @a vector to insert each element
+ * @param elmt the location of the elements to insert
+ * @param n the number of elements to insert from @a elmt
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_insert_many_z() - the explicit interface analogue
+ */
+//= inline vector_t vector_insert_many(
+//=     restrict vector_t vector,
+//=     const size_t *index,
+//=     const void *restrict elmt,
+//=     size_t n)
+#define vector_insert_many(v, ...) \
+  vector_insert_many_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Insert each of @a n elements from @a elmt into the @a vector before
+ *   the element at the corresponding index in @a index
+ *
+ * Each index in @a index is an index in the @a vector before any insertion (or
+ * its length to append) and must be no less than the index before it. The
+ * element at offset @c j in @a elmt is inserted before the element at
+ * <code>index[j]</code> so that its index in the resultant vector is
+ * <code>index[j] + j</code>. Elements with the same index are inserted in the
+ * order that they're in @a elmt. If @a elmt is @c NULL then the inserted
+ * elements will be uninitialized.
+ *
+ * This resizes the @a vector at most once and moves each existing element at
+ * most once, from the tail to the head, so it's much faster than @a n calls to
+ * vector_insert_z() when @a n is large.
+ *
+ * If the resultant length of the @a vector would overflow a @c size_t then this
+ * will set @c errno to @c ENOMEM and return @c NULL. Otherwise this will call
+ * vector_ensure_z(). If that fails then the @a vector will be unmodified and
+ * the value of @c errno set by realloc() will be retained.
+ *
+ * If @a index isn't sorted or any index in it is greater than the length of
+ * the @a vector then the behavior is undefined. If @a elmt is a location in the
+ * @a vector itself then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param index the sorted indices in the @a vector to insert each element
+ * @param elmt the location of the elements to insert
+ * @param n the number of elements to insert from @a elmt
+ * @param z the element size of the @a vector
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_insert_many() - the implicit interface analogue
+ */
+inline vector_t vector_insert_many_z(
+    restrict vector_t vector,
+    const size_t *index,
+    const void *restrict elmt,
+    size_t n,
+    size_t z)
+  __attribute__((nonnull(1), warn_unused_result));
+
+/**
+ * @brief Insert the data at @a elmt into the @a vector at index @a i by moving
+ *   the element at index @a i to the tail
+ *
+ * Unlike vector_insert() this doesn't retain the order of the elements in
+ * the @a vector. Instead the element at index @a i is copied to the tail of the
+ * @a vector and the inserted element takes its place, so only a single element
+ * is moved regardless of the length of the @a vector. If @a i is the length of
+ * the @a vector then this will append the element to the @a vector. If @a elmt
+ * is @c NULL then the inserted element will be uninitialized.
+ *
+ * If the resultant length of the @a vector would overflow a @c size_t then this
+ * will set @c errno to @c ENOMEM and return @c NULL. Otherwise this will call
+ * vector_ensure(). If that fails then the @a vector will be unmodified and
+ * the value of @c errno set by realloc() will be retained.
+ *
+ * If @a i is neither an index in the @a vector or its length then the behavior
+ * is undefined. If @a elmt is a location in the @a vector itself then the
+ * behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param i the index in the @a vector to insert the element
+ * @param elmt the location of the element to insert
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_swap_insert_z() - the explicit interface analogue
+ */
+//= inline vector_t vector_swap_insert(
+//=     restrict vector_t vector, size_t i, const void *restrict elmt)
+#define vector_swap_insert(v, ...) \
+  vector_swap_insert_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Insert the data at @a elmt into the @a vector at index @a i by moving
+ *   the element at index @a i to the tail
+ *
+ * Unlike vector_insert_z() this doesn't retain the order of the elements in
+ * the @a vector. Instead the element at index @a i is copied to the tail of the
+ * @a vector and the inserted element takes its place, so only a single element
+ * is moved regardless of the length of the @a vector. If @a i is the length of
+ * the @a vector then this will append the element to the @a vector. If @a elmt
+ * is @c NULL then the inserted element will be uninitialized.
+ *
+ * If the resultant length of the @a vector would overflow a @c size_t then this
+ * will set @c errno to @c ENOMEM and return @c NULL. Otherwise this will call
+ * vector_ensure_z(). If that fails then the @a vector will be unmodified and
+ * the value of @c errno set by realloc() will be retained.
+ *
+ * If @a i is neither an index in the @a vector or its length then the behavior
+ * is undefined. If @a elmt is a location in the @a vector itself then the
+ * behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param i the index in the @a vector to insert the element
+ * @param elmt the location of the element to insert
+ * @param z the element size of the @a vector
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_swap_insert() - the implicit interface analogue
+ */
+inline vector_t vector_swap_insert_z(
+    restrict vector_t vector,
+    size_t i,
+    const void *restrict elmt,
+    size_t z)
+  __attribute__((nonnull(1), warn_unused_result));
+
+/**
+ * @brief Replace @a n elements starting at index @a i in the @a vector with
+ *   @a m elements from @a elmt
+ *
+ * The elements after <code>i + n</code> are shifted only once, by the
+ * difference of @a m and @a n, and not at all if they're equal. The @a vector
+ * is expanded by vector_ensure() when @a m is greater than @a n, or contracted
+ * following the rule in vector_excise() when @a m is less than @a n, so it's
+ * reallocated at most once. This is more efficient than vector_excise()
+ * followed by vector_inject(), which shifts the elements twice and can contract
+ * the @a vector right before expanding it again. If @a elmt is @c NULL then
+ * the replacement elements will be uninitialized.
+ *
+ * If the resultant length of the @a vector would overflow a @c size_t then this
+ * will set @c errno to @c ENOMEM and return @c NULL. If the call to
+ * vector_ensure() fails then the @a vector will be unmodified and the value of
+ * @c errno set by realloc() will be retained.
+ *
+ * If the range isn't in the @a vector then the behavior is undefined. If
+ * @a elmt isn't @c NULL and its type is incompatible with the element type of
+ * the @a vector then the behavior is undefined. If @a elmt is a location in the
+ * @a vector itself then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param i the index of the first element in the @a vector to replace
+ * @param n the number of elements to replace
+ * @param elmt the location of the replacement elements
+ * @param m the number of elements to replace them with from @a elmt
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_replace_z() - the explicit interface analogue
+ */
+//= inline vector_t vector_replace(
+//=     restrict vector_t vector,
+//=     size_t i,
+//=     size_t n,
+//=     const void *restrict elmt,
+//=     size_t m)
+#define vector_replace(v, ...) \
+  vector_replace_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Replace @a n elements starting at index @a i in the @a vector with
+ *   @a m elements from @a elmt
+ *
+ * The elements after <code>i + n</code> are shifted only once, by the
+ * difference of @a m and @a n, and not at all if they're equal. The @a vector
+ * is expanded by vector_ensure_z() when @a m is greater than @a n, or
+ * contracted following the rule in vector_excise_z() when @a m is less than
+ * @a n, so it's reallocated at most once. This is more efficient than
+ * vector_excise_z() followed by vector_inject_z(), which shifts the elements
+ * twice and can contract the @a vector right before expanding it again. If
+ * @a elmt is @c NULL then the replacement elements will be uninitialized.
+ *
+ * If the resultant length of the @a vector would overflow a @c size_t then this
+ * will set @c errno to @c ENOMEM and return @c NULL. If the call to
+ * vector_ensure_z() fails then the @a vector will be unmodified and the value
+ * of @c errno set by realloc() will be retained.
+ *
+ * If the range isn't in the @a vector then the behavior is undefined. If
+ * @a elmt isn't @c NULL and its type is incompatible with the element type of
+ * the @a vector then the behavior is undefined. If @a elmt is a location in the
+ * @a vector itself then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param i the index of the first element in the @a vector to replace
+ * @param n the number of elements to replace
+ * @param elmt the location of the replacement elements
+ * @param m the number of elements to replace them with from @a elmt
+ * @param z the element size of the @a vector
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_replace() - the implicit interface analogue
+ */
+inline vector_t vector_replace_z(
+    restrict vector_t vector,
+    size_t i,
+    size_t n,
+    const void *restrict elmt,
+    size_t m,
+    size_t z)
+  __attribute__((nonnull(1), warn_unused_result));
+
+/**
+ * @brief Move @a n elements starting at index @a si of the vector at @a src
+ *   into the vector @a dst starting at index @a di
+ *
+ * The @a dst is ensured to accomodate the elements once, the elements of each
+ * vector after the range are shifted once, and the contraction of the source
+ * vector follows the rule in vector_excise() once. As the source vector can
+ * be moved by its contraction, it's passed by the location @a src of a pointer
+ * to it which is updated to the resultant source vector.
+ *
+ * If the resultant length of @a dst would overflow a @c size_t then this will
+ * set @c errno to @c ENOMEM and return @c NULL. Otherwise this will call
+ * vector_ensure() on @a dst. If that fails then neither vector will be
+ * modified and the value of @c errno set by realloc() will be retained.
+ *
+ * If @a di is neither an index in @a dst or its length, or the range isn't in
+ * the source vector, then the behavior is undefined. If @a dst and the source
+ * vector are the same vector then the behavior is undefined.
+ *
+ * @param dst the vector to move the elements into
+ * @param di the index in @a dst to move the elements to
+ * @param src the location of a pointer to the vector to move the elements from
+ * @param si the index of the first element in the source vector to move
+ * @param n the number of elements to move
+ * @return the resultant @a dst on success; otherwise @c NULL
+ *
+ * @see vector_splice_z() - the explicit interface analogue
+ */
+//= vector_t vector_splice(
+//=     vector_t dst, size_t di, vector_t *src, size_t si, size_t n)
+#define vector_splice(d, di, s, ...) vector_splice_z( \
+  (d), (di), (vector_t *) (s), __VA_ARGS__, VECTOR_Z((d)))
+
+/**
+ * @brief Move @a n elements starting at index @a si of the vector at @a src
+ *   into the vector @a dst starting at index @a di
+ *
+ * The @a dst is ensured to accomodate the elements once, the elements of each
+ * vector after the range are shifted once, and the contraction of the source
+ * vector follows the rule in vector_excise_z() once. As the source vector can
+ * be moved by its contraction, it's passed by the location @a src of a pointer
+ * to it which is updated to the resultant source vector.
+ *
+ * If the resultant length of @a dst would overflow a @c size_t then this will
+ * set @c errno to @c ENOMEM and return @c NULL. Otherwise this will call
+ * vector_ensure_z() on @a dst. If that fails then neither vector will be
+ * modified and the value of @c errno set by realloc() will be retained.
+ *
+ * If @a di is neither an index in @a dst or its length, or the range isn't in
+ * the source vector, then the behavior is undefined. If @a dst and the source
+ * vector are the same vector then the behavior is undefined.
+ *
+ * @param dst the vector to move the elements into
+ * @param di the index in @a dst to move the elements to
+ * @param src the location of a pointer to the vector to move the elements from
+ * @param si the index of the first element in the source vector to move
+ * @param n the number of elements to move
+ * @param z the element size of the vectors
+ * @return the resultant @a dst on success; otherwise @c NULL
+ *
+ * @see vector_splice() - the implicit interface analogue
+ */
+inline vector_t vector_splice_z(
+    vector_t dst,
+    size_t di,
+    vector_t *src,
+    size_t si,
+    size_t n,
+    size_t z)
+  __attribute__((nonnull, warn_unused_result));
+
 #ifdef VECTOR_TEST
 #undef inline
 #endif /* VECTOR_TEST */
@@ -0,0 +1,13 @@
+/// @file header/vector/io.c
+
+#ifndef VECTOR_IO_C
+#define VECTOR_IO_C
+
+// The functions that read into a vector are defined in source/vector/io.c
+// rather than inline here so that read(), pread() and readv() aren't declared
+// in each translation unit that includes vector.h.
+
+#include "common.h"
+#include "io.h"
+
+#endif /* VECTOR_IO_C */
@@ -0,0 +1,170 @@
+/// @file header/vector/io.h
+
+#ifndef VECTOR_IO_H
+#define VECTOR_IO_H
+
+#include <stddef.h>
+#include <sys/types.h>
+#include "common.h"
+
+/**
+ * @brief The size in bytes of the buffer on the stack of
+ *   vector_extend_from_fdv_z()
+ *
+ * This can be defined when the library is built.
+ */
+#ifndef VECTOR_IO_BUFFER
+#define VECTOR_IO_BUFFER 65536
+#endif /* VECTOR_IO_BUFFER */
+
+/**
+ * @brief Read up to @a max elements from the file descriptor @a fd into the
+ *   tail of the @a vector
+ *
+ * The @a vector is ensured to accomodate @a max more elements and then read()
+ * reads straight into the uninitialized tail of the @a vector. Only the
+ * elements actually read are appended to the @a vector, and their number is
+ * stored in @a count. This is zero at the end of file.
+ *
+ * If a read() returns part of an element then this continues to read() until
+ * the element is complete. The bytes of an incomplete element at the end of
+ * file are discarded. A read() interrupted by a signal is restarted.
+ *
+ * If the resultant volume would overflow or the ensure fails then this will
+ * return @c NULL and the @a vector will be unmodified. Otherwise the resultant
+ * vector is returned even if the read() fails, in which case @a count is set to
+ * -1 and the value of @c errno set by read() is retained.
+ *
+ * For example to read a whole file: @code{.c}
+ *   char *buffer = vector_create();
+ *   ssize_t count;
+ *   do
+ *     buffer = vector_extend_from_fd(buffer, fd, 65536, &count);
+ *   while (buffer != NULL && count > 0);
+ * @endcode
+ *
+ * @param vector the vector to operate on
+ * @param fd the file descriptor to read from
+ * @param max the maximum number of elements to read
+ * @param count the location to store the number of elements read
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_extend_from_fd_z() - the explicit interface analogue
+ */
+//= vector_t vector_extend_from_fd(
+//=     vector_t vector, int fd, size_t max, ssize_t *count)
+#define vector_extend_from_fd(v, ...) \
+  vector_extend_from_fd_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Read up to @a max elements from the file descriptor @a fd into the
+ *   tail of the @a vector
+ *
+ * The @a vector is ensured to accomodate @a max more elements and then read()
+ * reads straight into the uninitialized tail of the @a vector. Only the
+ * elements actually read are appended to the @a vector, and their number is
+ * stored in @a count. This is zero at the end of file.
+ *
+ * If a read() returns part of an element then this continues to read() until
+ * the element is complete. The bytes of an incomplete element at the end of
+ * file are discarded. A read() interrupted by a signal is restarted.
+ *
+ * If the resultant volume would overflow or the ensure fails then this will
+ * return @c NULL and the @a vector will be unmodified. Otherwise the resultant
+ * vector is returned even if the read() fails, in which case @a count is set to
+ * -1 and the value of @c errno set by read() is retained.
+ *
+ * @param vector the vector to operate on
+ * @param fd the file descriptor to read from
+ * @param max the maximum number of elements to read
+ * @param count the location to store the number of elements read
+ * @param z the element size of the @a vector
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_extend_from_fd() - the implicit interface analogue
+ */
+vector_t vector_extend_from_fd_z(
+    vector_t vector, int fd, size_t max, ssize_t *count, size_t z)
+  __attribute__((nonnull(1, 4), warn_unused_result));
+
+/**
+ * @brief Read up to @a max elements from the file descriptor @a fd at the
+ *   byte @a offset into the tail of the @a vector
+ *
+ * This is vector_extend_from_fd() with pread() rather than read(), so the file
+ * offset of @a fd isn't used or changed. If @a offset is negative then the
+ * behavior is undefined.
+ *
+ * @see vector_extend_from_fd_at_z() - the explicit interface analogue
+ */
+//= vector_t vector_extend_from_fd_at(
+//=     vector_t vector, int fd, off_t offset, size_t max, ssize_t *count)
+#define vector_extend_from_fd_at(v, ...) \
+  vector_extend_from_fd_at_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Read up to @a max elements from the file descriptor @a fd at the
+ *   byte @a offset into the tail of the @a vector
+ *
+ * This is vector_extend_from_fd_z() with pread() rather than read(), so the
+ * file offset of @a fd isn't used or changed. If @a offset is negative then the
+ * behavior is undefined.
+ *
+ * @see vector_extend_from_fd_at() - the implicit interface analogue
+ */
+vector_t vector_extend_from_fd_at_z(
+    vector_t vector, int fd, off_t offset, size_t max, ssize_t *count, size_t z)
+  __attribute__((nonnull(1, 5), warn_unused_result));
+
+/**
+ * @brief Read up to @a max elements from the file descriptor @a fd into the
+ *   volume of the @a vector and then a buffer on the stack
+ *
+ * Unlike vector_extend_from_fd() this doesn't ensure the @a vector can
+ * accomodate @a max more elements before reading. Instead a single readv()
+ * reads into the uninitialized tail of the @a vector up to its @volume and then
+ * into a buffer of @ref VECTOR_IO_BUFFER bytes on the stack. Only the elements
+ * that overflow into the buffer are copied into the @a vector with
+ * vector_extend(). So a vector with enough volume is read into without a copy
+ * while a vector without enough volume only grows by what was actually read.
+ *
+ * If the extend fails then this will return @c NULL. The elements read into the
+ * volume of the @a vector are retained and their number is stored in
+ * @a count, but those that overflowed into the buffer are lost. Otherwise this
+ * behaves like vector_extend_from_fd().
+ *
+ * @see vector_extend_from_fdv_z() - the explicit interface analogue
+ */
+//= vector_t vector_extend_from_fdv(
+//=     vector_t vector, int fd, size_t max, ssize_t *count)
+#define vector_extend_from_fdv(v, ...) \
+  vector_extend_from_fdv_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Read up to @a max elements from the file descriptor @a fd into the
+ *   volume of the @a vector and then a buffer on the stack
+ *
+ * Unlike vector_extend_from_fd_z() this doesn't ensure the @a vector can
+ * accomodate @a max more elements before reading. Instead a single readv()
+ * reads into the uninitialized tail of the @a vector up to its @volume and then
+ * into a buffer of @ref VECTOR_IO_BUFFER bytes on the stack. Only the elements
+ * that overflow into the buffer are copied into the @a vector with
+ * vector_extend_z(). So a vector with enough volume is read into without a copy
+ * while a vector without enough volume only grows by what was actually read.
+ *
+ * If the extend fails then this will return @c NULL. The elements read into the
+ * volume of the @a vector are retained and their number is stored in
+ * @a count, but those that overflowed into the buffer are lost. Otherwise this
+ * behaves like vector_extend_from_fd_z().
+ *
+ * @see vector_extend_from_fdv() - the implicit interface analogue
+ */
+vector_t vector_extend_from_fdv_z(
+    vector_t vector, int fd, size_t max, ssize_t *count, size_t z)
+  __attribute__((nonnull(1, 4), warn_unused_result));
+
+#endif /* VECTOR_IO_H */
+
+#ifndef VECTOR_TEST
+#include "io.c"
+#endif /* VECTOR_TEST */
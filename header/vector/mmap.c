@@ -0,0 +1,12 @@
+/// @file header/vector/mmap.c
+
+#ifndef VECTOR_MMAP_C
+#define VECTOR_MMAP_C
+
+// The functions of the vector_mmap are defined in source/vector/mmap.c rather
+// than inline here because mremap() is only declared with _GNU_SOURCE.
+
+#include "common.h"
+#include "mmap.h"
+
+#endif /* VECTOR_MMAP_C */
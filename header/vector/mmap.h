@@ -0,0 +1,65 @@
+/// @file header/vector/mmap.h
+
+#ifndef VECTOR_MMAP_H
+#define VECTOR_MMAP_H
+
+#include <stddef.h>
+#include "common.h"
+#include "allocator.h"
+
+/**
+ * @brief The size in bytes at and above which the @ref vector_mmap maps an
+ *   allocation
+ *
+ * This can be defined when the library is built.
+ */
+#ifndef VECTOR_MMAP_THRESHOLD
+#define VECTOR_MMAP_THRESHOLD ((size_t) 1 << 24)
+#endif /* VECTOR_MMAP_THRESHOLD */
+
+/**
+ * @brief An allocator that maps huge vectors into anonymous memory
+ *
+ * An allocation smaller than @ref VECTOR_MMAP_THRESHOLD bytes is passed to
+ * malloc(), realloc(), and free(). A larger allocation is made with mmap() and
+ * is resized with mremap() (where it's available) so that the growth of a huge
+ * vector remaps its pages rather than copying its elements. When a vector
+ * crosses the threshold in either direction its elements are copied once.
+ *
+ * For example: @code{.c}
+ *   char *buffer = vector_create_using(&vector_mmap);
+ * @endcode
+ */
+extern const struct vector_allocator_t vector_mmap;
+
+/**
+ * @brief A @ref vector_mmap that advises the kernel to back each mapping with
+ *   huge pages
+ *
+ * This is the same as @ref vector_mmap except that each mapping is given to
+ * madvise() with @c MADV_HUGEPAGE where it's available. This is only a hint and
+ * it's harmless where transparent huge pages are disabled.
+ */
+extern const struct vector_allocator_t vector_mmap_huge;
+
+/// @cond INTERNAL
+
+/// The @ref vector_allocator_t::allocate of the @ref vector_mmap
+void *__vector_mmap_allocate(size_t size, void *context);
+
+/// The @ref vector_allocator_t::reallocate of the @ref vector_mmap
+void *__vector_mmap_reallocate(
+    void *data, size_t prior, size_t size, void *context)
+  __attribute__((nonnull(1)));
+
+/// The @ref vector_allocator_t::deallocate of the @ref vector_mmap
+void __vector_mmap_deallocate(void *data, size_t size, void *context)
+  __attribute__((nonnull(1)));
+
+/// @endcond
+
+#endif /* VECTOR_MMAP_H */
+
+#ifndef VECTOR_TEST
+#include "mmap.c"
+#endif /* VECTOR_TEST */
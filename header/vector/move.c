@@ -5,10 +5,12 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "common.h"
 #include "move.h"
 #include "access.h"
+#include "stats.h"
 
 #ifdef VECTOR_TEST
 #define inline
@@ -16,28 +18,94 @@
 
 inline void vector_move_z(
     vector_t vector, size_t target, size_t source, size_t z) {
-  if (target == source)
+  if (target < source)
+    vector_rotate_z(vector, target, source - target + 1, source - target, z);
+  else if (target > source)
+    vector_rotate_z(vector, source, target - source + 1, 1, z);
+}
+
+inline void vector_swap_z(vector_t vector, size_t i, size_t j, size_t z) {
+  char *a = vector_at(vector, i, z);
+  char *b = vector_at(vector, j, z);
+
+  switch (z) {
+  case 1: __VECTOR_EXCHANGE(a, b, 1); break;
+  case 2: __VECTOR_EXCHANGE(a, b, 2); break;
+  case 4: __VECTOR_EXCHANGE(a, b, 4); break;
+  case 8: __VECTOR_EXCHANGE(a, b, 8); break;
+  case 16: __VECTOR_EXCHANGE(a, b, 16); break;
+  default: __vector_exchange(a, b, z); break;
+  }
+}
+
+inline void vector_rotate_z(
+    vector_t vector, size_t i, size_t n, size_t k, size_t z) {
+  char buffer[__VECTOR_ROTATE_BUFFER];
+
+  if (n == 0 || (k %= n) == 0)
+    return;
+
+  // the sizes in bytes of the left and right sides of the rotation
+  char *base = vector_at(vector, i, z);
+  size_t left = k * z, right = (n - k) * z;
+
+  // Block swap the sides in place until the smaller side fits in the buffer.
+  // Each swap moves the smaller side into its final place at one end of the
+  // range and leaves a smaller rotation of the rest.
+  while (left > sizeof(buffer) && right > sizeof(buffer)) {
+    if (left <= right) {
+      __vector_exchange(base, base + right, left);
+      right -= left;
+    } else {
+      __vector_exchange(base, base + left, right);
+      base += right;
+      left -= right;
+    }
+  }
+
+  // when the sides were equal the block swaps completed the rotation
+  if (left == 0 || right == 0)
     return;
 
-  if (target < source) {
-    while (source-- > target)
-      vector_swap_z(vector, source, source + 1, z);
+  // set aside the smaller side and memmove() the larger side over it
+  if (left <= right) {
+    memcpy(buffer, base, left);
+    memmove(base, base + left, right);
+    memcpy(base + right, buffer, left);
+    __vector_stats_add(move_bytes, right);
   } else {
-    for (; source < target; source++)
-      vector_swap_z(vector, source, source + 1, z);
+    memcpy(buffer, base + left, right);
+    memmove(base + right, base, left);
+    memcpy(base, buffer, right);
+    __vector_stats_add(move_bytes, left);
   }
 }
 
-inline void vector_swap_z(vector_t vector, size_t i, size_t j, size_t z) {
-  char *a = vector_at(vector, i, z);
-  char *b = vector_at(vector, j, z);
+inline void __vector_exchange(void *a, void *b, size_t size) {
+  char *x = a, *y = b;
+
+  for (; size >= 32; x += 32, y += 32, size -= 32)
+    __VECTOR_EXCHANGE(x, y, 32);
 
-  for (size_t k = 0; k < z; k++) {
-    char buffer;
-    buffer = a[k];
-    a[k] = b[k];
-    b[k] = buffer;
+  // exchange the rest of the bytes from the largest chunk to the smallest
+  if (size & 16) {
+    __VECTOR_EXCHANGE(x, y, 16);
+    x += 16, y += 16;
+  }
+  if (size & 8) {
+    __VECTOR_EXCHANGE(x, y, 8);
+    x += 8, y += 8;
+  }
+  if (size & 4) {
+    __VECTOR_EXCHANGE(x, y, 4);
+    x += 4, y += 4;
+  }
+  if (size & 2) {
+    __VECTOR_EXCHANGE(x, y, 2);
+    x += 2, y += 2;
   }
+  if (size & 1)
+    __VECTOR_EXCHANGE(x, y, 1);
 }
 
 #ifdef VECTOR_TEST
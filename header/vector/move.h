@@ -17,6 +17,9 @@
  * @note Though this is implemented as a macro it's documented as a function to
  * clarify its intended usage.
  *
+ * Because the element size of the @a vector is a constant, the swap for that
+ * size is selected at compile time when vector_swap_z() is inlined.
+ *
  * If either @a i or @a j isn't an index in the @a vector then the behavior of
  * this operation is undefined.
  *
@@ -33,6 +36,12 @@
  * @brief Swap the element at index @a i with the element at index @a j in the
  * @a vector
  *
+ * An element of 1, 2, 4, 8 or 16 bytes is swapped through a pair of registers.
+ * A larger element is swapped in chunks of 32 bytes (which the compiler emits
+ * as SIMD loads and stores where they're available) followed by the rest in
+ * chunks of 16, 8, 4, 2 and 1 bytes. The swap is selected on @a z at runtime
+ * or at compile time if @a z is a constant.
+ *
  * If either @a i or @a j isn't an index in the @a vector then the behavior of
  * this operation is undefined.
  *
@@ -54,7 +63,8 @@ inline void vector_swap_z(vector_t vector, size_t i, size_t j, size_t z)
  * element previously at index @a target to index <code>target + 1</code>, and
  * so on. When complete the length of the @a vector is unchanged and (with the
  * exception of the element at @a source) the relative order of each element in
- * the @a vector is unchanged. For example:
+ * the @a vector is unchanged. This is a vector_rotate() by one element of the
+ * range between @a target and @a source. For example:
  *
  * \code{.c}
  * int *sample = vector_define(int, 2, 4, 6, 8, 10, 12);
@@ -82,7 +92,8 @@ inline void vector_swap_z(vector_t vector, size_t i, size_t j, size_t z)
  * element previously at index @a target to index <code>target + 1</code>, and
  * so on. When complete the length of the @a vector is unchanged and (with the
  * exception of the element at @a source) the relative order of each element in
- * the @a vector is unchanged. For example:
+ * the @a vector is unchanged. This is a vector_rotate() by one element of the
+ * range between @a target and @a source. For example:
  *
  * \code{.c}
  * int *sample = vector_define(int, 2, 4, 6, 8, 10, 12);
@@ -104,6 +115,96 @@ inline void vector_move_z(
     vector_t vector, size_t target, size_t source, size_t z)
   __attribute__((nonnull));
 
+/**
+ * @brief Rotate the @a n elements starting at index @a i in the @a vector
+ *   @a k elements toward the head
+ *
+ * The element at index <code>i + k</code> is moved to index @a i, the element
+ * at index <code>i + k + 1</code> to <code>i + 1</code>, and so on while the
+ * first @a k elements wrap around to the end of the range. If @a k isn't less
+ * than @a n then the rotation is by <code>k % n</code>. For example:
+ *
+ * \code{.c}
+ * int *sample = vector_define(int, 2, 4, 6, 8, 10, 12);
+ * vector_rotate(sample, 1, 4, 1);
+ * sample == { 2, 6, 8, 10, 4, 12 };
+ * \endcode
+ *
+ * When either side of the rotation is small it's set aside in a buffer on the
+ * stack while the other side is moved with a single memmove(). Otherwise the
+ * sides are block swapped in place.
+ *
+ * If the range isn't in the @a vector then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param i the index of the first element in the @a vector to rotate
+ * @param n the number of elements to rotate
+ * @param k the number of elements to rotate the range by
+ *
+ * @see vector_rotate_z() - The explicit interface analogue
+ */
+//= void vector_rotate(vector_t vector, size_t i, size_t n, size_t k)
+#define vector_rotate(v, ...) vector_rotate_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Rotate the @a n elements starting at index @a i in the @a vector
+ *   @a k elements toward the head
+ *
+ * The element at index <code>i + k</code> is moved to index @a i, the element
+ * at index <code>i + k + 1</code> to <code>i + 1</code>, and so on while the
+ * first @a k elements wrap around to the end of the range. If @a k isn't less
+ * than @a n then the rotation is by <code>k % n</code>. For example:
+ *
+ * \code{.c}
+ * int *sample = vector_define(int, 2, 4, 6, 8, 10, 12);
+ * vector_rotate(sample, 1, 4, 1);
+ * sample == { 2, 6, 8, 10, 4, 12 };
+ * \endcode
+ *
+ * When either side of the rotation is small it's set aside in a buffer on the
+ * stack while the other side is moved with a single memmove(). Otherwise the
+ * sides are block swapped in place.
+ *
+ * If the range isn't in the @a vector then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param i the index of the first element in the @a vector to rotate
+ * @param n the number of elements to rotate
+ * @param k the number of elements to rotate the range by
+ * @param z the element size of the @a vector
+ *
+ * @see vector_rotate() - The implicit interface analogue
+ */
+inline void vector_rotate_z(
+    vector_t vector, size_t i, size_t n, size_t k, size_t z)
+  __attribute__((nonnull));
+
+/// @cond INTERNAL
+
+/// The size in bytes of the buffer on the stack of vector_rotate_z()
+#define __VECTOR_ROTATE_BUFFER 256
+
+/**
+ * @brief Exchange the @a n bytes at @a a with the @a n bytes at @a b where
+ *   @a n is a constant
+ *
+ * Each memcpy() of a constant size is compiled to a load or store of a
+ * register of that size.
+ */
+#define __VECTOR_EXCHANGE(a, b, n) do { \
+  char __x[(n)], __y[(n)]; \
+  memcpy(__x, (a), (n)); \
+  memcpy(__y, (b), (n)); \
+  memcpy((a), __y, (n)); \
+  memcpy((b), __x, (n)); \
+} while (0)
+
+/// Exchange the @a size bytes at @a a with the @a size bytes at @a b
+inline void __vector_exchange(void *a, void *b, size_t size)
+  __attribute__((nonnull));
+
+/// @endcond
+
 #ifdef VECTOR_TEST
 #undef inline
 #endif /* VECTOR_TEST */
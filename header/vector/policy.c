@@ -0,0 +1,135 @@
+/// @file header/vector/policy.c
+
+#ifndef VECTOR_POLICY_C
+#define VECTOR_POLICY_C
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common.h"
+#include "policy.h"
+
+#ifdef VECTOR_TEST
+#define inline
+#endif /* VECTOR_TEST */
+
+inline const struct vector_policy_t *vector_policy(vector_c vector) {
+  return __vector_to_header(vector)->policy;
+}
+
+inline void vector_set_policy(
+    vector_t vector, const struct vector_policy_t *policy) {
+  __vector_to_header(vector)->policy = policy;
+}
+
+inline size_t vector_expand_8_5(
+    size_t volume, size_t length, size_t z,
+    const struct vector_policy_t *policy) {
+  (void) volume, (void) z, (void) policy;
+  // (length * 8 + 3) / 5 without overflowing before the division
+  return length / 5 * 8 + ((length % 5) * 8 + 3) / 5;
+}
+
+inline size_t vector_expand_2(
+    size_t volume, size_t length, size_t z,
+    const struct vector_policy_t *policy) {
+  (void) volume, (void) z, (void) policy;
+  return length > SIZE_MAX / 2 ? length : length * 2;
+}
+
+inline size_t vector_expand_3_2(
+    size_t volume, size_t length, size_t z,
+    const struct vector_policy_t *policy) {
+  size_t result;
+  (void) volume, (void) z, (void) policy;
+  if (__builtin_add_overflow(length, length / 2, &result))
+    return length;
+  return result;
+}
+
+inline size_t vector_expand_page(
+    size_t volume, size_t length, size_t z,
+    const struct vector_policy_t *policy) {
+  volume = vector_expand_8_5(volume, length, z, policy);
+  return __vector_policy_round(volume, z, VECTOR_PAGE_SIZE);
+}
+
+inline size_t vector_expand_class(
+    size_t volume, size_t length, size_t z,
+    const struct vector_policy_t *policy) {
+  size_t size, granule = 1;
+
+  volume = vector_expand_8_5(volume, length, z, policy);
+  if (__builtin_mul_overflow(volume, z, &size)
+      || __builtin_add_overflow(size, sizeof(struct __vector_header_t), &size))
+    return length;
+
+  if (size >= VECTOR_PAGE_SIZE)
+    return __vector_policy_round(volume, z, VECTOR_PAGE_SIZE);
+  while (granule < size)
+    granule <<= 1;
+  return __vector_policy_round(volume, z, granule);
+}
+
+inline size_t vector_expand_increment(
+    size_t volume, size_t length, size_t z,
+    const struct vector_policy_t *policy) {
+  size_t increment = policy->expansion, result;
+  (void) volume, (void) z;
+
+  if (increment == 0 || length % increment == 0)
+    return length;
+  if (__builtin_add_overflow(
+        length, increment - length % increment, &result))
+    return length;
+  return result;
+}
+
+inline size_t vector_contract_half(
+    size_t volume, size_t length, size_t z,
+    const struct vector_policy_t *policy) {
+  (void) z, (void) policy;
+  if (length > (volume - 1) / 2)
+    return volume;
+  // (length * 6 + 4) / 5 without overflowing before the division
+  return length / 5 * 6 + ((length % 5) * 6 + 4) / 5;
+}
+
+inline size_t vector_contract_never(
+    size_t volume, size_t length, size_t z,
+    const struct vector_policy_t *policy) {
+  (void) length, (void) z, (void) policy;
+  return volume;
+}
+
+inline size_t vector_contract_divisor(
+    size_t volume, size_t length, size_t z,
+    const struct vector_policy_t *policy) {
+  size_t divisor = policy->contraction;
+
+  if (divisor < 2 || length > volume / divisor)
+    return volume;
+  return vector_expand_8_5(length, length, z, policy);
+}
+
+inline const struct vector_policy_t *__vector_policy(vector_c vector) {
+  const struct vector_policy_t *policy = __vector_to_header(vector)->policy;
+  return policy != NULL ? policy : &VECTOR_POLICY;
+}
+
+inline size_t __vector_policy_round(size_t volume, size_t z, size_t granule) {
+  size_t size, header = sizeof(struct __vector_header_t);
+
+  if (z == 0
+      || __builtin_mul_overflow(volume, z, &size)
+      || __builtin_add_overflow(size, header + granule - 1, &size))
+    return volume;
+  size -= size % granule;
+  return (size - header) / z;
+}
+
+#ifdef VECTOR_TEST
+#undef inline
+#endif /* VECTOR_TEST */
+
+#endif /* VECTOR_POLICY_C */
@@ -0,0 +1,239 @@
+/// @file header/vector/policy.h
+
+#ifndef VECTOR_POLICY_H
+#define VECTOR_POLICY_H
+
+#include <stddef.h>
+#include "common.h"
+
+#ifdef VECTOR_TEST
+#define inline
+#endif /* VECTOR_TEST */
+
+/// The page size assumed by vector_expand_page() and vector_expand_class()
+#ifndef VECTOR_PAGE_SIZE
+#define VECTOR_PAGE_SIZE 4096
+#endif /* VECTOR_PAGE_SIZE */
+
+/**
+ * @brief The policy used by a vector that isn't bound to one
+ *
+ * This can be defined at build time as the name of a
+ * <code>const struct vector_policy_t</code> to change the policy of each
+ * vector that isn't bound to one. It must be defined the same in each
+ * translation unit, including those of the library itself.
+ */
+#ifndef VECTOR_POLICY
+#define VECTOR_POLICY vector_policy_default
+#endif /* VECTOR_POLICY */
+
+/**
+ * @brief A policy on how a vector expands and contracts its volume
+ *
+ * When vector_ensure_z() needs to increase the volume of a vector it calls
+ * @a expand to calculate the volume to preallocate. When the length of a vector
+ * is reduced by vector_excise_z() (and so vector_remove_z(), vector_pull_z(),
+ * etc.) it calls @a contract to calculate the volume to reduce it to.
+ *
+ * A vector is bound to a policy with vector_set_policy(). Otherwise its policy
+ * is @ref VECTOR_POLICY which is @ref vector_policy_default unless defined
+ * otherwise at build time. Any combination of the vector_expand_*() and
+ * vector_contract_*() functions can be used in a policy. For example: @code{.c}
+ *   static const struct vector_policy_t policy = {
+ *     .expand = vector_expand_increment,
+ *     .contract = vector_contract_never,
+ *     .expansion = 256,
+ *   };
+ *   vector_set_policy(vector, &policy);
+ * @endcode
+ */
+struct vector_policy_t {
+  /**
+   * @brief Return the volume to resize a vector with @a volume elements of
+   *   size @a z to in order to accomodate @a length elements
+   *
+   * This is only called when @a length is greater than @a volume. If the result
+   * isn't greater than @a length (such as on overflow) then the vector is
+   * resized to just @a length.
+   */
+  size_t (*expand)(
+      size_t volume, size_t length, size_t z,
+      const struct vector_policy_t *policy);
+
+  /**
+   * @brief Return the volume to resize a vector with @a volume elements of
+   *   size @a z to once its length is reduced to @a length
+   *
+   * If the result isn't less than @a volume then the vector isn't resized.
+   */
+  size_t (*contract)(
+      size_t volume, size_t length, size_t z,
+      const struct vector_policy_t *policy);
+
+  /// A parameter of @a expand such as the increment of
+  /// vector_expand_increment()
+  size_t expansion;
+
+  /// A parameter of @a contract such as the divisor of
+  /// vector_contract_divisor()
+  size_t contraction;
+
+  /**
+   * @brief Whether to record the slack of each allocation as volume
+   *
+   * An allocator typically rounds the size of an allocation up to a size class.
+   * When this is set, vector_resize_z() asks the vector's allocator (or
+   * malloc_usable_size()) for the usable size of each allocation and sets the
+   * volume of the vector to the number of elements that fit in it. As a result
+   * the volume of the vector can be greater than requested (even by
+   * vector_resize_z() and vector_shrink_z()) and an insertion that fits in the
+   * slack won't realloc().
+   */
+  _Bool slack;
+};
+
+/**
+ * @brief The default policy
+ *
+ * This is vector_expand_8_5() with vector_contract_half().
+ */
+extern const struct vector_policy_t vector_policy_default;
+
+/**
+ * @brief A policy that rounds each allocation up to a size class and records
+ *   its slack as volume
+ *
+ * This is vector_expand_class() with vector_contract_half() and
+ * @ref vector_policy_t::slack.
+ */
+extern const struct vector_policy_t vector_policy_class;
+
+/// Return the policy that the @a vector is bound to or @c NULL
+inline const struct vector_policy_t *vector_policy(vector_c vector)
+  __attribute__((nonnull, pure));
+
+/**
+ * @brief Bind the @a vector to the @a policy
+ *
+ * The @a policy isn't copied so it must outlive the @a vector. If @a policy is
+ * @c NULL then the @a vector will use @ref VECTOR_POLICY.
+ */
+inline void vector_set_policy(
+    vector_t vector, const struct vector_policy_t *policy)
+  __attribute__((nonnull(1)));
+
+/**
+ * @brief Expand to 8/5 of the length
+ *
+ * That is:
+ *   @f[ volume = \frac{length \times 8 + 3}{5} @f]
+ */
+inline size_t vector_expand_8_5(
+    size_t volume, size_t length, size_t z,
+    const struct vector_policy_t *policy)
+  __attribute__((const));
+
+/// Expand to twice the length
+inline size_t vector_expand_2(
+    size_t volume, size_t length, size_t z,
+    const struct vector_policy_t *policy)
+  __attribute__((const));
+
+/// Expand to 3/2 of the length
+inline size_t vector_expand_3_2(
+    size_t volume, size_t length, size_t z,
+    const struct vector_policy_t *policy)
+  __attribute__((const));
+
+/**
+ * @brief Expand to 8/5 of the length and then round the size of the
+ *   allocation up to a multiple of @ref VECTOR_PAGE_SIZE
+ */
+inline size_t vector_expand_page(
+    size_t volume, size_t length, size_t z,
+    const struct vector_policy_t *policy)
+  __attribute__((const));
+
+/**
+ * @brief Expand to 8/5 of the length and then round the size of the
+ *   allocation up to a typical malloc() size class
+ *
+ * The size of an allocation smaller than @ref VECTOR_PAGE_SIZE is rounded up to
+ * a power of two. Otherwise it's rounded up to a multiple of
+ * @ref VECTOR_PAGE_SIZE.
+ */
+inline size_t vector_expand_class(
+    size_t volume, size_t length, size_t z,
+    const struct vector_policy_t *policy)
+  __attribute__((const));
+
+/**
+ * @brief Expand to the length rounded up to a multiple of the policy's
+ *   @ref vector_policy_t::expansion
+ *
+ * If the expansion is zero then this won't preallocate.
+ */
+inline size_t vector_expand_increment(
+    size_t volume, size_t length, size_t z,
+    const struct vector_policy_t *policy)
+  __attribute__((nonnull(4), pure));
+
+/**
+ * @brief Once the length is no greater than half the volume, contract to 6/5
+ *   of the length
+ *
+ * That is once @f$ length \le \frac{1}{2}(volume - 1) @f$:
+ *   @f[ volume = \frac{length \times 6 + 4}{5} @f]
+ */
+inline size_t vector_contract_half(
+    size_t volume, size_t length, size_t z,
+    const struct vector_policy_t *policy)
+  __attribute__((const));
+
+/// Never contract
+inline size_t vector_contract_never(
+    size_t volume, size_t length, size_t z,
+    const struct vector_policy_t *policy)
+  __attribute__((const));
+
+/**
+ * @brief Once the length is no greater than the volume divided by the policy's
+ *   @ref vector_policy_t::contraction, contract to 8/5 of the length
+ *
+ * A greater contraction keeps more of the volume around when the length of a
+ * vector fluctuates. If the contraction is less than two then this will never
+ * contract.
+ */
+inline size_t vector_contract_divisor(
+    size_t volume, size_t length, size_t z,
+    const struct vector_policy_t *policy)
+  __attribute__((nonnull(4), pure));
+
+/// @cond INTERNAL
+
+/**
+ * @brief Return the policy of the @a vector or @ref VECTOR_POLICY if it isn't
+ *   bound to one
+ */
+inline const struct vector_policy_t *__vector_policy(vector_c vector)
+  __attribute__((nonnull, returns_nonnull, pure));
+
+/**
+ * @brief Return the greatest volume of elements of size @a z that fits in the
+ *   size of an allocation for @a volume elements rounded up to a multiple of
+ *   @a granule
+ */
+inline size_t __vector_policy_round(size_t volume, size_t z, size_t granule)
+  __attribute__((const));
+
+/// @endcond
+
+#ifdef VECTOR_TEST
+#undef inline
+#endif /* VECTOR_TEST */
+
+#endif /* VECTOR_POLICY_H */
+
+#ifndef VECTOR_TEST
+#include "policy.c"
+#endif /* VECTOR_TEST */
@@ -3,6 +3,7 @@
 #ifndef VECTOR_REMOVE_C
 #define VECTOR_REMOVE_C
 
+#include <limits.h>
 #include <stddef.h>
 #include <string.h>
 
@@ -10,6 +11,8 @@
 #include "remove.h"
 #include "access.h"
 #include "resize.h"
+#include "policy.h"
+#include "stats.h"
 
 #ifdef VECTOR_TEST
 #define inline
@@ -20,20 +23,24 @@ inline vector_t vector_remove_z(vector_t vector, size_t i, size_t z) {
 }
 
 inline vector_t vector_excise_z(vector_t vector, size_t i, size_t n, size_t z) {
+  const struct vector_policy_t *policy = __vector_policy(vector);
   size_t length = vector_length(vector) - n;
+  size_t volume = vector_volume(vector);
+  size_t contract = volume;
+
+  if (!(__vector_to_header(vector)->flags & __VECTOR_PINNED))
+    contract = policy->contract(volume, length, z, policy);
 
   // move the existing elements n elements toward the head
   void *target = vector_at(vector, i + 0, z);
   void *source = vector_at(vector, i + n, z);
   size_t size = (length - i) * z;
   memmove(target, source, size);
+  __vector_stats_add(move_bytes, size);
 
-  if (length <= (vector_volume(vector) - 1) / 2) {
+  if (contract < volume) {
     vector_t resize;
-    // just volume = (length * 6 + 4) / 5 avoiding intermediate overflow
-    size_t volume = length / 5 * 6 + ((length % 5) * 6 + 4) / 5;
-
-    if ((resize = vector_resize_z(vector, volume, z)) != NULL)
+    if ((resize = vector_resize_z(vector, contract, z)) != NULL)
       vector = resize;
   }
 
@@ -48,6 +55,128 @@ inline vector_t vector_truncate_z(vector_t vector, size_t length, size_t z) {
   return vector_excise_z(vector, vector_length(vector) - n, n, z);
 }
 
+inline vector_t vector_swap_remove_z(vector_t vector, size_t i, size_t z) {
+  size_t length = vector_length(vector) - 1;
+
+  if (i != length)
+    memcpy(vector_at(vector, i, z), vector_at(vector, length, z), z);
+
+  return vector_truncate_z(vector, length, z);
+}
+
+inline vector_t vector_remove_if_z(
+    vector_t vector, _Bool (*test)(const void *elmt), size_t z) {
+  return __vector_filter_z(vector, test, NULL, NULL, 0, z);
+}
+
+inline vector_t vector_remove_if_with_z(
+    vector_t vector,
+    _Bool (*test)(const void *elmt, void *data),
+    void *data,
+    size_t z) {
+  return __vector_filter_z(vector, NULL, test, data, 0, z);
+}
+
+inline vector_t vector_retain_z(
+    vector_t vector, _Bool (*test)(const void *elmt), size_t z) {
+  return __vector_filter_z(vector, test, NULL, NULL, 1, z);
+}
+
+inline vector_t vector_retain_with_z(
+    vector_t vector,
+    _Bool (*test)(const void *elmt, void *data),
+    void *data,
+    size_t z) {
+  return __vector_filter_z(vector, NULL, test, data, 1, z);
+}
+
+inline vector_t vector_excise_indices_z(
+    vector_t vector, const size_t *indices, size_t count, size_t z) {
+  size_t length = vector_length(vector);
+
+  if (count == 0)
+    return vector;
+
+  // j is the index that the run of elements after each removed index is moved
+  // to
+  size_t j = indices[0];
+  for (size_t k = 0; k < count; k++) {
+    // the run ends at the next distinct index or the length of the vector
+    size_t head = indices[k] + 1, tail = length;
+    while (k + 1 < count && indices[k + 1] == indices[k])
+      k++;
+    if (k + 1 < count)
+      tail = indices[k + 1];
+    j = __vector_compact_z(vector, j, head, tail - head, z);
+  }
+
+  return vector_truncate_z(vector, j, z);
+}
+
+inline vector_t vector_excise_bitmap_z(
+    vector_t vector, const unsigned char *bitmap, size_t z) {
+  size_t length = vector_length(vector);
+  size_t head = 0, j = 0;
+
+  for (size_t i = 0; i < length; i++) {
+    unsigned char byte = bitmap[i / CHAR_BIT];
+
+    // skip each byte of the bitmap without a removed index
+    if (i % CHAR_BIT == 0 && byte == 0) {
+      i += CHAR_BIT - 1;
+      continue;
+    }
+    if ((byte >> (i % CHAR_BIT) & 1) == 0)
+      continue;
+
+    j = __vector_compact_z(vector, j, head, i - head, z);
+    head = i + 1;
+  }
+  if (head < length)
+    j = __vector_compact_z(vector, j, head, length - head, z);
+
+  return vector_truncate_z(vector, j, z);
+}
+
+inline size_t __vector_compact_z(
+    vector_t vector, size_t j, size_t i, size_t n, size_t z) {
+  if (i != j && n != 0) {
+    void *target = vector_at(vector, j, z);
+    void *source = vector_at(vector, i, z);
+    memmove(target, source, n * z);
+    __vector_stats_add(move_bytes, n * z);
+  }
+  return j + n;
+}
+
+inline vector_t __vector_filter_z(
+    vector_t vector,
+    _Bool (*test)(const void *elmt),
+    _Bool (*test_with)(const void *elmt, void *data),
+    void *data,
+    _Bool keep,
+    size_t z) {
+  size_t length = vector_length(vector);
+  size_t head = 0, j = 0;
+
+  // Move each run of kept elements toward the head in a single pass where head
+  // is the index of the current run and j is the index that it's moved to. The
+  // index at length ends the last run.
+  for (size_t i = 0; i <= length; i++) {
+    if (i < length) {
+      void *elmt = vector_at(vector, i, z);
+      if ((test != NULL ? test(elmt) : test_with(elmt, data)) == keep)
+        continue;
+    }
+
+    j = __vector_compact_z(vector, j, head, i - head, z);
+    head = i + 1;
+  }
+
+  // remove the tail and apply the shrink policy once
+  return vector_truncate_z(vector, j, z);
+}
+
 #ifdef VECTOR_TEST
 #undef inline
 #endif /* VECTOR_TEST */
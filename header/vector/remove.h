@@ -22,6 +22,7 @@
  * \frac{1}{2}(volume - 1) @f$, a vector_resize() will be attempted to reduce
  * the @volume to:
  *   @f[ volume = \frac{length \times 6 + 4}{5} @f]
+ * This is the default which the @ref vector_policy_t of the vector can change.
  * On success the shrunk vector will be returned. Otherwise the vector will be
  * returned as is (without the element).
  *
@@ -45,6 +46,7 @@
  * \frac{1}{2}(volume - 1) @f$, a vector_resize_z() will be attempted to reduce
  * the @volume to:
  *   @f[ volume = \frac{length \times 6 + 4}{5} @f]
+ * This is the default which the @ref vector_policy_t of the vector can change.
  * On success the shrunk vector will be returned. Otherwise the vector will be
  * returned as is (without the element).
  *
@@ -69,6 +71,7 @@ inline vector_t vector_remove_z(vector_t vector, size_t i, size_t z)
  * \frac{1}{2}(volume - 1) @f$, a vector_resize() will be attempted to reduce
  * the @volume to:
  *   @f[ volume = \frac{length \times 6 + 4}{5} @f]
+ * This is the default which the @ref vector_policy_t of the vector can change.
  * On success the shrunk vector will be returned. Otherwise the vector will be
  * returned as is (without the elements).
  *
@@ -94,6 +97,7 @@ inline vector_t vector_remove_z(vector_t vector, size_t i, size_t z)
  * \frac{1}{2}(volume - 1) @f$, a vector_resize_z() will be attempted to reduce
  * the @volume to:
  *   @f[ volume = \frac{length \times 6 + 4}{5} @f]
+ * This is the default which the @ref vector_policy_t of the vector can change.
  * On success the shrunk vector will be returned. Otherwise the vector will be
  * returned as is (without the elements).
  *
@@ -147,6 +151,363 @@ inline vector_t vector_excise_z(vector_t vector, size_t i, size_t n, size_t z)
 inline vector_t vector_truncate_z(vector_t vector, size_t length, size_t z)
   __attribute__((nonnull, returns_nonnull, warn_unused_result));
 
+/**
+ * @brief Remove each element from the @a vector that satisfies @a test
+ *
+ * Each element in the @a vector is passed to @a test exactly once, in order
+ * from the head to the tail. The elements that remain are moved toward the head
+ * of the @a vector in a single pass that retains their order. Once all elements
+ * are tested the @volume of the @a vector follows the rule in
+ * vector_excise() once.
+ *
+ * If @a test modifies the @a vector then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param test the predicate that each element is tested with
+ * @return the resultant vector
+ *
+ * @see vector_remove_if_z() - the explicit interface analogue
+ */
+//= vector_t vector_remove_if(vector_t vector, _Bool (*test)(const void *elmt))
+#define vector_remove_if(v, ...) \
+  vector_remove_if_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Remove each element from the @a vector that satisfies @a test
+ *
+ * Each element in the @a vector is passed to @a test exactly once, in order
+ * from the head to the tail. The elements that remain are moved toward the head
+ * of the @a vector in a single pass that retains their order. Once all elements
+ * are tested the @volume of the @a vector follows the rule in
+ * vector_excise_z() once.
+ *
+ * If @a test modifies the @a vector then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param test the predicate that each element is tested with
+ * @param z the element size of the @a vector
+ * @return the resultant vector
+ *
+ * @see vector_remove_if() - the implicit interface analogue
+ */
+inline vector_t vector_remove_if_z(
+    vector_t vector, _Bool (*test)(const void *elmt), size_t z)
+  __attribute__((nonnull(1, 2), returns_nonnull, warn_unused_result));
+
+/**
+ * @brief Remove each element from the @a vector that satisfies a contextual
+ *   @a test
+ *
+ * Each element in the @a vector is passed to @a test exactly once, in order
+ * from the head to the tail. The elements that remain are moved toward the head
+ * of the @a vector in a single pass that retains their order. Once all elements
+ * are tested the @volume of the @a vector follows the rule in
+ * vector_excise() once.
+ *
+ * If @a test modifies the @a vector then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param test the predicate that each element is tested with
+ * @param data contextual information to pass as the last argument to @a test
+ * @return the resultant vector
+ *
+ * @see vector_remove_if_with_z() - the explicit interface analogue
+ */
+//= vector_t vector_remove_if_with(
+//=     vector_t vector,
+//=     _Bool (*test)(const void *elmt, void *data),
+//=     void *data)
+#define vector_remove_if_with(v, ...) \
+  vector_remove_if_with_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Remove each element from the @a vector that satisfies a contextual
+ *   @a test
+ *
+ * Each element in the @a vector is passed to @a test exactly once, in order
+ * from the head to the tail. The elements that remain are moved toward the head
+ * of the @a vector in a single pass that retains their order. Once all elements
+ * are tested the @volume of the @a vector follows the rule in
+ * vector_excise_z() once.
+ *
+ * If @a test modifies the @a vector then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param test the predicate that each element is tested with
+ * @param data contextual information to pass as the last argument to @a test
+ * @param z the element size of the @a vector
+ * @return the resultant vector
+ *
+ * @see vector_remove_if_with() - the implicit interface analogue
+ */
+inline vector_t vector_remove_if_with_z(
+    vector_t vector,
+    _Bool (*test)(const void *elmt, void *data),
+    void *data,
+    size_t z)
+  __attribute__((nonnull(1, 2), returns_nonnull, warn_unused_result));
+
+/**
+ * @brief Remove each element from the @a vector that doesn't satisfy @a test
+ *
+ * Each element in the @a vector is passed to @a test exactly once, in order
+ * from the head to the tail. The elements that remain are moved toward the head
+ * of the @a vector in a single pass that retains their order. Once all elements
+ * are tested the @volume of the @a vector follows the rule in
+ * vector_excise() once.
+ *
+ * If @a test modifies the @a vector then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param test the predicate that each element is tested with
+ * @return the resultant vector
+ *
+ * @see vector_retain_z() - the explicit interface analogue
+ */
+//= vector_t vector_retain(vector_t vector, _Bool (*test)(const void *elmt))
+#define vector_retain(v, ...) \
+  vector_retain_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Remove each element from the @a vector that doesn't satisfy @a test
+ *
+ * Each element in the @a vector is passed to @a test exactly once, in order
+ * from the head to the tail. The elements that remain are moved toward the head
+ * of the @a vector in a single pass that retains their order. Once all elements
+ * are tested the @volume of the @a vector follows the rule in
+ * vector_excise_z() once.
+ *
+ * If @a test modifies the @a vector then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param test the predicate that each element is tested with
+ * @param z the element size of the @a vector
+ * @return the resultant vector
+ *
+ * @see vector_retain() - the implicit interface analogue
+ */
+inline vector_t vector_retain_z(
+    vector_t vector, _Bool (*test)(const void *elmt), size_t z)
+  __attribute__((nonnull(1, 2), returns_nonnull, warn_unused_result));
+
+/**
+ * @brief Remove each element from the @a vector that doesn't satisfy a
+ *   contextual @a test
+ *
+ * Each element in the @a vector is passed to @a test exactly once, in order
+ * from the head to the tail. The elements that remain are moved toward the head
+ * of the @a vector in a single pass that retains their order. Once all elements
+ * are tested the @volume of the @a vector follows the rule in
+ * vector_excise() once.
+ *
+ * If @a test modifies the @a vector then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param test the predicate that each element is tested with
+ * @param data contextual information to pass as the last argument to @a test
+ * @return the resultant vector
+ *
+ * @see vector_retain_with_z() - the explicit interface analogue
+ */
+//= vector_t vector_retain_with(
+//=     vector_t vector,
+//=     _Bool (*test)(const void *elmt, void *data),
+//=     void *data)
+#define vector_retain_with(v, ...) \
+  vector_retain_with_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Remove each element from the @a vector that doesn't satisfy a
+ *   contextual @a test
+ *
+ * Each element in the @a vector is passed to @a test exactly once, in order
+ * from the head to the tail. The elements that remain are moved toward the head
+ * of the @a vector in a single pass that retains their order. Once all elements
+ * are tested the @volume of the @a vector follows the rule in
+ * vector_excise_z() once.
+ *
+ * If @a test modifies the @a vector then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param test the predicate that each element is tested with
+ * @param data contextual information to pass as the last argument to @a test
+ * @param z the element size of the @a vector
+ * @return the resultant vector
+ *
+ * @see vector_retain_with() - the implicit interface analogue
+ */
+inline vector_t vector_retain_with_z(
+    vector_t vector,
+    _Bool (*test)(const void *elmt, void *data),
+    void *data,
+    size_t z)
+  __attribute__((nonnull(1, 2), returns_nonnull, warn_unused_result));
+
+/**
+ * @brief Remove the element at each of the @a count indices in @a indices from
+ *   the @a vector
+ *
+ * The indices must be in ascending order. An index that's repeated is removed
+ * once. The remaining elements are moved toward the head of the @a vector in a
+ * single pass that retains their order and the @length of the @a vector is
+ * updated once. Then the @volume of the @a vector follows the rule in
+ * vector_excise() once.
+ *
+ * If @a indices isn't in ascending order or any index in it isn't an index in
+ * the @a vector then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param indices the ascending indices of the elements to remove
+ * @param count the number of indices in @a indices
+ * @return the resultant vector
+ *
+ * @see vector_excise_indices_z() - the explicit interface analogue
+ */
+//= vector_t vector_excise_indices(
+//=     vector_t vector, const size_t *indices, size_t count)
+#define vector_excise_indices(v, ...) \
+  vector_excise_indices_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Remove the element at each of the @a count indices in @a indices from
+ *   the @a vector
+ *
+ * The indices must be in ascending order. An index that's repeated is removed
+ * once. The remaining elements are moved toward the head of the @a vector in a
+ * single pass that retains their order and the @length of the @a vector is
+ * updated once. Then the @volume of the @a vector follows the rule in
+ * vector_excise_z() once.
+ *
+ * If @a indices isn't in ascending order or any index in it isn't an index in
+ * the @a vector then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param indices the ascending indices of the elements to remove
+ * @param count the number of indices in @a indices
+ * @param z the element size of the @a vector
+ * @return the resultant vector
+ *
+ * @see vector_excise_indices() - the implicit interface analogue
+ */
+inline vector_t vector_excise_indices_z(
+    vector_t vector, const size_t *indices, size_t count, size_t z)
+  __attribute__((nonnull(1), returns_nonnull, warn_unused_result));
+
+/**
+ * @brief Remove the element at each index in the @a vector whose bit is set in
+ *   @a bitmap
+ *
+ * The bit of index @c i is
+ * <code>bitmap[i / CHAR_BIT] >> (i % CHAR_BIT) & 1</code> and @a bitmap must
+ * have a bit for each index in the @a vector. The remaining elements are moved
+ * toward the head of the @a vector in a single pass that retains their order
+ * and the @length of the @a vector is updated once. Then the @volume of the
+ * @a vector follows the rule in vector_excise() once.
+ *
+ * @param vector the vector to operate on
+ * @param bitmap the bitmap of the indices of the elements to remove
+ * @return the resultant vector
+ *
+ * @see vector_excise_bitmap_z() - the explicit interface analogue
+ */
+//= vector_t vector_excise_bitmap(vector_t vector, const unsigned char *bitmap)
+#define vector_excise_bitmap(v, ...) \
+  vector_excise_bitmap_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Remove the element at each index in the @a vector whose bit is set in
+ *   @a bitmap
+ *
+ * The bit of index @c i is
+ * <code>bitmap[i / CHAR_BIT] >> (i % CHAR_BIT) & 1</code> and @a bitmap must
+ * have a bit for each index in the @a vector. The remaining elements are moved
+ * toward the head of the @a vector in a single pass that retains their order
+ * and the @length of the @a vector is updated once. Then the @volume of the
+ * @a vector follows the rule in vector_excise_z() once.
+ *
+ * @param vector the vector to operate on
+ * @param bitmap the bitmap of the indices of the elements to remove
+ * @param z the element size of the @a vector
+ * @return the resultant vector
+ *
+ * @see vector_excise_bitmap() - the implicit interface analogue
+ */
+inline vector_t vector_excise_bitmap_z(
+    vector_t vector, const unsigned char *bitmap, size_t z)
+  __attribute__((nonnull, returns_nonnull, warn_unused_result));
+
+/**
+ * @brief Remove the element at index @a i from the @a vector by replacing it
+ *   with the last element
+ *
+ * Unlike vector_remove() this doesn't retain the order of the elements in
+ * the @a vector. Instead the last element is copied to index @a i and the
+ * @length of the @a vector is reduced by one, so only a single element is
+ * moved regardless of the length of the @a vector. Then the @volume of the
+ * @a vector follows the rule in vector_excise().
+ *
+ * If @a i isn't an index in the @a vector then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param i the index in the @a vector of the element to remove
+ * @return the resultant vector
+ *
+ * @see vector_swap_remove_z() - the explicit interface analogue
+ */
+//= vector_t vector_swap_remove(vector_t vector, size_t i)
+#define vector_swap_remove(v, ...) \
+  vector_swap_remove_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Remove the element at index @a i from the @a vector by replacing it
+ *   with the last element
+ *
+ * Unlike vector_remove_z() this doesn't retain the order of the elements in
+ * the @a vector. Instead the last element is copied to index @a i and the
+ * @length of the @a vector is reduced by one, so only a single element is
+ * moved regardless of the length of the @a vector. Then the @volume of the
+ * @a vector follows the rule in vector_excise_z().
+ *
+ * If @a i isn't an index in the @a vector then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param i the index in the @a vector of the element to remove
+ * @param z the element size of the @a vector
+ * @return the resultant vector
+ *
+ * @see vector_swap_remove() - the implicit interface analogue
+ */
+inline vector_t vector_swap_remove_z(vector_t vector, size_t i, size_t z)
+  __attribute__((nonnull, returns_nonnull, warn_unused_result));
+
+/// @cond INTERNAL
+
+/**
+ * @brief Remove each element from the @a vector for which @a test (or
+ *   @a test_with if @a test is @c NULL) doesn't return @a keep
+ */
+inline vector_t __vector_filter_z(
+    vector_t vector,
+    _Bool (*test)(const void *elmt),
+    _Bool (*test_with)(const void *elmt, void *data),
+    void *data,
+    _Bool keep,
+    size_t z)
+  __attribute__((nonnull(1), returns_nonnull, warn_unused_result));
+
+/**
+ * @brief Move the @a n elements at index @a i in the @a vector to index @a j
+ *   and return <code>j + n</code>
+ *
+ * This is a step of a compaction toward the head of the @a vector so @a j must
+ * be no greater than @a i.
+ */
+inline size_t __vector_compact_z(
+    vector_t vector, size_t j, size_t i, size_t n, size_t z)
+  __attribute__((nonnull));
+
+/// @endcond
+
 #ifdef VECTOR_TEST
 #undef inline
 #endif /* VECTOR_TEST */
@@ -4,18 +4,34 @@
 #define VECTOR_RESIZE_C
 
 #include <errno.h>
-#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
 
 #include "common.h"
 #include "resize.h"
+#include "allocator.h"
+#include "policy.h"
+#include "ring.h"
+#include "stats.h"
 
 #ifdef VECTOR_TEST
 #define inline
 #endif /* VECTOR_TEST */
 
 inline vector_t vector_resize_z(vector_t vector, size_t volume, size_t z) {
+  const struct vector_policy_t *policy = __vector_policy(vector);
   struct __vector_header_t *header = __vector_to_header(vector);
-  size_t size;
+  size_t size, limit = SIZE_MAX;
+
+  // the head of a ring must be able to index any element in its storage
+  if (header->flags & __VECTOR_RING)
+    limit = __VECTOR_RING_VOLUME_MAX;
+  if (volume > limit)
+    return errno = ENOMEM, NULL;
+
+  // the elements of a ring are moved to the start of its storage so they can't
+  // wrap around past the end of the resized storage
+  __vector_ring_linearize_z(vector, z);
 
   // calculate size and test for overflow
   if (__builtin_mul_overflow(volume, z, &size))
@@ -23,12 +39,45 @@ inline vector_t vector_resize_z(vector_t vector, size_t volume, size_t z) {
   if (__builtin_add_overflow(size, sizeof(*header), &size))
     return errno = ENOMEM, NULL;
 
-  if ((header = realloc(header, size)) == NULL)
-    return NULL;
+  if (header->size == 0) {
+    // The vector is in storage provided by its creator which can't be resized.
+    // Retain the storage unless it's too small for the volume.
+    if (volume <= header->volume) {
+      if (volume < header->length)
+        header->length = volume;
+      return header->data;
+    }
+
+    struct __vector_header_t *result;
+    if ((result = __vector_allocate(header->allocator, size)) == NULL)
+      return NULL;
+    header = memcpy(result, header, sizeof(*header) + header->length * z);
+  } else {
+    header = __vector_reallocate(header->allocator, header, header->size, size);
+    if (header == NULL)
+      return NULL;
+  }
 
-  if ((header->volume = volume) < header->length)
+  // truncate to the requested volume since the elements after it aren't kept
+  if (volume < header->length)
     header->length = volume;
 
+  // record the slack of the allocation as volume
+  if (policy->slack && z != 0) {
+    size = __vector_usable(header->allocator, header, size);
+    size_t slack = (size - sizeof(*header)) / z;
+    if (slack > volume)
+      volume = slack < limit ? slack : limit;
+  }
+
+  if (volume > header->volume)
+    __vector_stats_add(grow, 1);
+  else if (volume < header->volume)
+    __vector_stats_add(shrink, 1);
+
+  header->size = size;
+  header->volume = volume;
+
   return header->data;
 }
 
@@ -41,11 +90,13 @@ inline vector_t vector_shrink_z(vector_t vector, size_t z) {
 }
 
 inline vector_t vector_ensure_z(vector_t vector, size_t length, size_t z) {
-  if (length <= vector_volume(vector))
+  const struct vector_policy_t *policy = __vector_policy(vector);
+  size_t volume = vector_volume(vector);
+
+  if (length <= volume)
     return vector;
 
-  // just volume = (length * 8 + 3) / 5 avoiding intermediate overflow
-  size_t volume = length / 5 * 8 + ((length % 5) * 8 + 3) / 5;
+  volume = policy->expand(volume, length, z, policy);
 
   // if the volume doesn't overflow then attempt to allocate it
   if (volume > length) {
@@ -59,6 +110,18 @@ inline vector_t vector_ensure_z(vector_t vector, size_t length, size_t z) {
   return vector_resize_z(vector, length, z);
 }
 
+inline void vector_pin(vector_t vector) {
+  __vector_to_header(vector)->flags |= __VECTOR_PINNED;
+}
+
+inline void vector_unpin(vector_t vector) {
+  __vector_to_header(vector)->flags &= ~__VECTOR_PINNED;
+}
+
+inline _Bool vector_pinned(vector_c vector) {
+  return __vector_to_header(vector)->flags & __VECTOR_PINNED;
+}
+
 #ifdef VECTOR_TEST
 #undef inline
 #endif /* VECTOR_TEST */
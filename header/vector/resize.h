@@ -43,6 +43,10 @@
  * either case if the realloc() fails then the @a vector will be unmodified and
  * the value of @c errno set by realloc() will be retained.
  *
+ * If the @a vector is in storage provided to vector_create_inline_z() and
+ * @a volume is no greater than its volume then the storage and its volume are
+ * retained. Otherwise the @a vector is moved into a new allocation.
+ *
  * @param vector the vector to operate on
  * @param volume the volume to resize the @a vector to
  * @param z the element size of the @a vector
@@ -58,7 +62,8 @@ inline vector_t vector_resize_z(vector_t vector, size_t volume, size_t z)
  *
  * If the volume of the @a vector is less than @a length then vector_resize()
  * will be called. Preallocation is attempted to accomodate future increases in
- * @length according to the formula:
+ * @length according to the expand function of the vector's
+ * @ref vector_policy_t. By default this is:
  *   @f[ volume = \frac{length \times 8 + 3}{5} @f]
  * If this preallocation fails then a resize to @a length will be attempted. If
  * that also fails then the @a vector will be unmodified.
@@ -82,7 +87,8 @@ inline vector_t vector_resize_z(vector_t vector, size_t volume, size_t z)
  *
  * If the volume of the @a vector is less than @a length then vector_resize_z()
  * will be called. Preallocation is attempted to accomodate future increases in
- * @length according to the formula:
+ * @length according to the expand function of the vector's
+ * @ref vector_policy_t. By default this is:
  *   @f[ volume = \frac{length \times 8 + 3}{5} @f]
  * If this preallocation fails then a resize to @a length will be attempted. If
  * that also fails then the @a vector will be unmodified.
@@ -133,6 +139,26 @@ inline vector_t vector_ensure_z(vector_t vector, size_t length, size_t z)
 inline vector_t vector_shrink_z(vector_t vector, size_t z)
   __attribute__((nonnull, returns_nonnull, warn_unused_result));
 
+/**
+ * @brief Pin the @volume of the @a vector
+ *
+ * The volume of a pinned vector isn't reduced when an element is removed from
+ * it (by vector_remove(), vector_excise(), vector_truncate(), vector_pull(),
+ * vector_shift(), etc.) regardless of its @ref vector_policy_t. So once a
+ * pinned vector has grown, a loop that drains and refills it won't realloc()
+ * or move its elements.
+ *
+ * An explicit vector_shrink() or vector_resize() still changes the volume of a
+ * pinned vector. The vector remains pinned until vector_unpin().
+ */
+inline void vector_pin(vector_t vector) __attribute__((nonnull));
+
+/// Unpin the @volume of the @a vector
+inline void vector_unpin(vector_t vector) __attribute__((nonnull));
+
+/// Return whether the @volume of the @a vector is pinned
+inline _Bool vector_pinned(vector_c vector) __attribute__((nonnull, pure));
+
 #ifdef VECTOR_TEST
 #undef inline
 #endif /* VECTOR_TEST */
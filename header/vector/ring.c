@@ -0,0 +1,131 @@
+/// @file header/vector/ring.c
+
+#ifndef VECTOR_RING_C
+#define VECTOR_RING_C
+
+#include <errno.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "common.h"
+#include "ring.h"
+#include "access.h"
+#include "move.h"
+#include "resize.h"
+#include "stats.h"
+
+#ifdef VECTOR_TEST
+#define inline
+#endif /* VECTOR_TEST */
+
+inline vector_t vector_ring(vector_t vector) {
+  struct __vector_header_t *header = __vector_to_header(vector);
+
+  if (header->volume > __VECTOR_RING_VOLUME_MAX)
+    return errno = ENOMEM, NULL;
+
+  header->flags |= __VECTOR_RING;
+  return vector;
+}
+
+inline void vector_unring_z(vector_t vector, size_t z) {
+  __vector_ring_linearize_z(vector, z);
+  __vector_to_header(vector)->flags &= ~__VECTOR_RING;
+}
+
+inline _Bool vector_ringed(vector_c vector) {
+  return __vector_to_header(vector)->flags & __VECTOR_RING;
+}
+
+inline size_t vector_segments_z(
+    vector_t vector, struct vector_segment_t segment[2], size_t z) {
+  struct __vector_header_t *header = __vector_to_header(vector);
+  size_t head = header->head, length = header->length;
+
+  if (length == 0)
+    return 0;
+
+  segment[0].data = vector_at(vector, head, z);
+  if (length <= header->volume - head) {
+    segment[0].length = length;
+    return 1;
+  }
+
+  segment[0].length = header->volume - head;
+  segment[1].data = vector;
+  segment[1].length = length - segment[0].length;
+  return 2;
+}
+
+inline size_t __vector_ring_index(vector_c vector, size_t i) {
+  const struct __vector_header_t *header = __vector_to_header(vector);
+
+  i += header->head;
+  return i < header->volume ? i : i - header->volume;
+}
+
+inline void __vector_ring_linearize_z(vector_t vector, size_t z) {
+  struct __vector_header_t *header = __vector_to_header(vector);
+  size_t head = header->head, volume = header->volume;
+
+  if (head == 0)
+    return;
+
+  if (header->length <= volume - head) {
+    memmove(vector, vector_at(vector, head, z), header->length * z);
+    __vector_stats_add(move_bytes, header->length * z);
+  } else {
+    // rotate the storage head elements toward its start
+    vector_rotate_z(vector, 0, volume, head, z);
+  }
+
+  header->head = 0;
+}
+
+inline vector_t __vector_ring_push_z(
+    vector_t vector, const void *restrict elmt, size_t z) {
+  size_t length = vector_length(vector);
+
+  if (__builtin_add_overflow(length, 1, &length))
+    return errno = ENOMEM, NULL;
+
+  if ((vector = vector_ensure_z(vector, length, z)) == NULL)
+    return NULL;
+
+  if (elmt != NULL)
+    memcpy(vector_ring_at(vector, length - 1, z), elmt, z);
+
+  // increase the length
+  __vector_to_header(vector)->length = length;
+
+  return vector;
+}
+
+inline vector_t __vector_ring_unshift_z(
+    vector_t vector, const void *restrict elmt, size_t z) {
+  size_t length = vector_length(vector);
+
+  if (__builtin_add_overflow(length, 1, &length))
+    return errno = ENOMEM, NULL;
+
+  if ((vector = vector_ensure_z(vector, length, z)) == NULL)
+    return NULL;
+
+  // move the head one element toward the start, wrapping around to the end
+  struct __vector_header_t *header = __vector_to_header(vector);
+  header->head = (header->head == 0 ? header->volume : header->head) - 1;
+
+  if (elmt != NULL)
+    memcpy(vector_ring_at(vector, 0, z), elmt, z);
+
+  // increase the length
+  header->length = length;
+
+  return vector;
+}
+
+#ifdef VECTOR_TEST
+#undef inline
+#endif /* VECTOR_TEST */
+
+#endif /* VECTOR_RING_C */
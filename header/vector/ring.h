@@ -0,0 +1,183 @@
+/// @file header/vector/ring.h
+
+#ifndef VECTOR_RING_H
+#define VECTOR_RING_H
+
+#include <stddef.h>
+#include "common.h"
+
+#ifdef VECTOR_TEST
+#define inline
+#endif /* VECTOR_TEST */
+
+/**
+ * @brief A contiguous run of elements in a vector
+ *
+ * @see vector_segments_z() - the operation that produces these
+ */
+struct vector_segment_t {
+  /// A pointer to the first element in the run
+  void *data;
+  /// The number of elements in the run
+  size_t length;
+};
+
+/**
+ * @brief Make the @a vector a ring
+ *
+ * The elements of a ring start at an arbitrary index in its storage and wrap
+ * around from the end of its storage to the start. This lets vector_shift()
+ * and vector_unshift() add and remove the first element of a ring without
+ * moving any other element, so a ring used as a queue is amortized O(1) at
+ * both ends like vector_push() and vector_pull().
+ *
+ * As a result <code>vector[i]</code> and vector_at() address the storage of a
+ * ring rather than its elements. Use vector_ring_at() to address the element
+ * at an index and vector_segments() to iterate over each of its elements in
+ * bulk. Only vector_push(), vector_append(), vector_pull(), vector_shift(),
+ * vector_unshift(), vector_truncate(), vector_resize(), vector_ensure(),
+ * vector_shrink(), vector_duplicate() and vector_delete() support a ring. Any
+ * other operation requires vector_unring() beforehand.
+ *
+ * Any resize of a ring moves its elements back to the start of its storage.
+ *
+ * The index of the first element of a ring is stored in the bits of a word
+ * that aren't used by the flags of the @a vector, so the volume of a ring is
+ * limited to <code>2^(N - 4)</code> elements where @c N is the width of a
+ * @c size_t. A resize of a ring beyond that volume fails with @c ENOMEM.
+ *
+ * @param vector the vector to operate on
+ * @return the @a vector on success; otherwise @c NULL with @c errno set to
+ *   @c ENOMEM if the volume of the @a vector is too large for a ring
+ */
+inline vector_t vector_ring(vector_t vector)
+  __attribute__((nonnull, warn_unused_result));
+
+/**
+ * @brief Move the elements of the @a vector to the start of its storage and
+ *   make it no longer a ring
+ *
+ * Afterward <code>vector[i]</code> is the element at index @a i again.
+ *
+ * @see vector_unring_z() - the explicit interface analogue
+ */
+//= void vector_unring(vector_t vector)
+#define vector_unring(v) vector_unring_z((v), VECTOR_Z((v)))
+
+/**
+ * @brief Move the elements of the @a vector to the start of its storage and
+ *   make it no longer a ring
+ *
+ * Afterward <code>vector[i]</code> is the element at index @a i again.
+ *
+ * @param vector the vector to operate on
+ * @param z the element size of the @a vector
+ *
+ * @see vector_unring() - the implicit interface analogue
+ */
+inline void vector_unring_z(vector_t vector, size_t z) __attribute__((nonnull));
+
+/// Return whether the @a vector is a ring
+inline _Bool vector_ringed(vector_c vector) __attribute__((nonnull, pure));
+
+/**
+ * @brief Return a pointer to the element in the ring @a vector at index @a i
+ *
+ * @note Like vector_at() this is a part of the explicit interface despite the
+ * lack of the @c _z suffix and is implemented as a macro.
+ *
+ * If the @a vector isn't a ring this is identical to vector_at(). This
+ * operation is @c const qualified on the @a vector in the same way as
+ * vector_at().
+ *
+ * If @a i isn't an index in the @a vector then the behavior is undefined.
+ */
+//= void *vector_ring_at(vector_t vector, size_t i, size_t z)
+#define vector_ring_at(vector, i, z) ({ \
+  const void *__vector = (vector); \
+  _Pragma("GCC diagnostic push") \
+  _Pragma("GCC diagnostic ignored \"-Wcast-align\"") \
+  _Pragma("GCC diagnostic ignored \"-Wcast-qual\"") \
+  (__typeof__((vector))) ((const char *) (__vector) \
+    + __vector_ring_index(__vector, (i)) * (z)); \
+  _Pragma("GCC diagnostic pop") \
+})
+
+/**
+ * @brief Store the contiguous runs of elements of the @a vector in @a segment
+ *   and return the number of them
+ *
+ * The elements of a ring are in at most two runs: from its first element to the
+ * end of its storage and then from the start of its storage. Otherwise the
+ * elements of a vector are in a single run. No run is stored for a vector with
+ * a @length of zero.
+ *
+ * For example to sum each of the elements of @c vector in order: @code{.c}
+ *   struct vector_segment_t segment[2];
+ *   size_t n = vector_segments(vector, segment);
+ *   for (size_t k = 0; k < n; k++)
+ *     for (size_t i = 0; i < segment[k].length; i++)
+ *       sum += ((int *) segment[k].data)[i];
+ * @endcode
+ *
+ * @param vector the vector to operate on
+ * @param segment the location of the two runs to store
+ * @return the number of runs stored
+ *
+ * @see vector_segments_z() - the explicit interface analogue
+ */
+//= size_t vector_segments(vector_t vector, struct vector_segment_t segment[2])
+#define vector_segments(v, ...) \
+  vector_segments_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Store the contiguous runs of elements of the @a vector in @a segment
+ *   and return the number of them
+ *
+ * The elements of a ring are in at most two runs: from its first element to the
+ * end of its storage and then from the start of its storage. Otherwise the
+ * elements of a vector are in a single run. No run is stored for a vector with
+ * a @length of zero.
+ *
+ * @param vector the vector to operate on
+ * @param segment the location of the two runs to store
+ * @param z the element size of the @a vector
+ * @return the number of runs stored
+ *
+ * @see vector_segments() - the implicit interface analogue
+ */
+inline size_t vector_segments_z(
+    vector_t vector, struct vector_segment_t segment[2], size_t z)
+  __attribute__((nonnull));
+
+/// @cond INTERNAL
+
+/// Return the index in the storage of the element at index @a i in a @a vector
+inline size_t __vector_ring_index(vector_c vector, size_t i)
+  __attribute__((nonnull, pure));
+
+/// Move the elements of the @a vector to the start of its storage
+inline void __vector_ring_linearize_z(vector_t vector, size_t z)
+  __attribute__((nonnull));
+
+/// vector_append_z() on a ring
+inline vector_t __vector_ring_push_z(
+    vector_t vector, const void *restrict elmt, size_t z)
+  __attribute__((nonnull(1), warn_unused_result));
+
+/// vector_unshift_z() on a ring
+inline vector_t __vector_ring_unshift_z(
+    vector_t vector, const void *restrict elmt, size_t z)
+  __attribute__((nonnull(1), warn_unused_result));
+
+/// @endcond
+
+#ifdef VECTOR_TEST
+#undef inline
+#endif /* VECTOR_TEST */
+
+#endif /* VECTOR_RING_H */
+
+#ifndef VECTOR_TEST
+#include "ring.c"
+#endif /* VECTOR_TEST */
@@ -3,9 +3,14 @@
 #ifndef VECTOR_SEARCH_C
 #define VECTOR_SEARCH_C
 
+// The vector_find_value_z() family is defined in source/vector/search.c rather
+// than inline here so that the SIMD intrinsics it is built from aren't exposed
+// through the public header.
+
 #include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "common.h"
 #include "search.h"
@@ -54,20 +59,205 @@ inline size_t vector_search_z(
     const void *elmt,
     int (*cmpf)(const void *a, const void *b),
     size_t z) {
-  size_t length = vector_length(vector);
-  void *result;
+  size_t n = vector_length(vector);
+  size_t i = __vector_bound_z(vector, 0, n, elmt, cmpf, NULL, NULL, 0, z);
 
-  if ((result = bsearch(elmt, vector, length, z, cmpf)) == NULL)
-    return SIZE_MAX;
+  if (i < n && cmpf(elmt, vector_at(vector, i, z)) == 0)
+    return i;
+  return SIZE_MAX;
+}
 
-  size_t i = vector_index(vector, result, z);
+inline size_t vector_lower_bound_z(
+    vector_c vector,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b),
+    size_t z) {
+  size_t n = vector_length(vector);
+  return __vector_bound_z(vector, 0, n, elmt, cmpf, NULL, NULL, 0, z);
+}
 
-  while (i > 0 && cmpf(vector_at(vector, i - 1, z), elmt) == 0)
-    i--;
+inline size_t vector_lower_bound_with_z(
+    vector_c vector,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b, void *data),
+    void *data,
+    size_t z) {
+  size_t n = vector_length(vector);
+  return __vector_bound_z(vector, 0, n, elmt, NULL, cmpf, data, 0, z);
+}
+
+inline size_t vector_upper_bound_z(
+    vector_c vector,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b),
+    size_t z) {
+  size_t n = vector_length(vector);
+  return __vector_bound_z(vector, 0, n, elmt, cmpf, NULL, NULL, 1, z);
+}
 
+inline size_t vector_upper_bound_with_z(
+    vector_c vector,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b, void *data),
+    void *data,
+    size_t z) {
+  size_t n = vector_length(vector);
+  return __vector_bound_z(vector, 0, n, elmt, NULL, cmpf, data, 1, z);
+}
+
+inline size_t vector_equal_range_z(
+    vector_c vector,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b),
+    size_t *end,
+    size_t z) {
+  size_t n = vector_length(vector);
+  size_t i = __vector_bound_z(vector, 0, n, elmt, cmpf, NULL, NULL, 0, z);
+  *end = __vector_bound_z(vector, i, n, elmt, cmpf, NULL, NULL, 1, z);
   return i;
 }
 
+inline size_t vector_equal_range_with_z(
+    vector_c vector,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b, void *data),
+    void *data,
+    size_t *end,
+    size_t z) {
+  size_t n = vector_length(vector);
+  size_t i = __vector_bound_z(vector, 0, n, elmt, NULL, cmpf, data, 0, z);
+  *end = __vector_bound_z(vector, i, n, elmt, NULL, cmpf, data, 1, z);
+  return i;
+}
+
+inline size_t __vector_bound_z(
+    vector_c vector,
+    size_t i,
+    size_t j,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b),
+    int (*cmpf_with)(const void *a, const void *b, void *data),
+    void *data,
+    _Bool upper,
+    size_t z) {
+  size_t n = j - i;
+
+  if (n == 0)
+    return i;
+
+  // Halve the n elements starting at i until only one is left. The number of
+  // steps depends only on n and each step picks a half without a branch on the
+  // comparison, which the processor couldn't predict.
+  while (n > 1) {
+    size_t half = n / 2;
+    const void *a = vector_at(vector, i + half, z);
+    int c = cmpf != NULL ? cmpf(elmt, a) : cmpf_with(elmt, a, data);
+    i = (upper ? c >= 0 : c > 0) ? i + half : i;
+    n -= half;
+  }
+
+  // then the bound is either that element or the one after it
+  const void *a = vector_at(vector, i, z);
+  int c = cmpf != NULL ? cmpf(elmt, a) : cmpf_with(elmt, a, data);
+  return i + (upper ? c >= 0 : c > 0);
+}
+
+inline void vector_search_many_z(
+    vector_c vector,
+    const void *keys,
+    size_t nkeys,
+    int (*cmpf)(const void *a, const void *b),
+    size_t *out,
+    size_t z) {
+  size_t length = vector_length(vector);
+  const char *key = keys;
+
+  if (__vector_sorted(keys, nkeys, cmpf, z)) {
+    __vector_search_merge_z(vector, keys, nkeys, cmpf, out, z);
+    return;
+  }
+
+  for (size_t k = 0; k < nkeys; k += __VECTOR_SEARCH_GROUP) {
+    size_t base[__VECTOR_SEARCH_GROUP] = { 0 };
+    size_t m = nkeys - k < __VECTOR_SEARCH_GROUP
+      ? nkeys - k
+      : __VECTOR_SEARCH_GROUP;
+
+    // Run the binary search of __vector_bound_z() for each key in the group
+    // in lock-step. Each search takes the same steps as they depend only on
+    // the length, so after each compare the next element that its search will
+    // compare is prefetched and is likely to be loaded by the time the rest of
+    // the group has been compared.
+    for (size_t n = length; n > 1; ) {
+      size_t half = n / 2;
+      for (size_t g = 0; g < m; g++) {
+        const void *a = vector_at(vector, base[g] + half, z);
+        base[g] = cmpf(key + (k + g) * z, a) > 0 ? base[g] + half : base[g];
+        __builtin_prefetch(vector_at(vector, base[g] + (n - half) / 2, z));
+      }
+      n -= half;
+    }
+
+    for (size_t g = 0; g < m; g++) {
+      const void *elmt = key + (k + g) * z;
+      size_t i = base[g];
+      if (i < length && cmpf(elmt, vector_at(vector, i, z)) > 0)
+        i++;
+      if (i < length && cmpf(elmt, vector_at(vector, i, z)) == 0)
+        out[k + g] = i;
+      else
+        out[k + g] = SIZE_MAX;
+    }
+  }
+}
+
+inline _Bool __vector_sorted(
+    const void *keys,
+    size_t nkeys,
+    int (*cmpf)(const void *a, const void *b),
+    size_t z) {
+  const char *key = keys;
+
+  for (size_t k = 1; k < nkeys; k++) {
+    if (cmpf(key + (k - 1) * z, key + k * z) > 0)
+      return 0;
+  }
+  return 1;
+}
+
+inline void __vector_search_merge_z(
+    vector_c vector,
+    const void *keys,
+    size_t nkeys,
+    int (*cmpf)(const void *a, const void *b),
+    size_t *out,
+    size_t z) {
+  size_t length = vector_length(vector);
+  const char *key = keys;
+  size_t i = 0;
+
+  for (size_t k = 0; k < nkeys; k++) {
+    const void *elmt = key + k * z;
+
+    // Gallop from the bound of the last key to bracket the bound of this key
+    // between lo and hi. Each element before lo is less than the key and the
+    // element at hi (if any) isn't.
+    size_t lo = i, hi = i;
+    for (size_t step = 1; hi < length; step *= 2) {
+      if (cmpf(elmt, vector_at(vector, hi, z)) <= 0)
+        break;
+      lo = hi + 1;
+      hi = length - hi > step ? hi + step : length;
+    }
+
+    i = __vector_bound_z(vector, lo, hi, elmt, cmpf, NULL, NULL, 0, z);
+    if (i < length && cmpf(elmt, vector_at(vector, i, z)) == 0)
+      out[k] = i;
+    else
+      out[k] = SIZE_MAX;
+  }
+}
+
 #ifdef VECTOR_TEST
 #undef inline
 #endif /* VECTOR_TEST */
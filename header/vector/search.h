@@ -4,6 +4,7 @@
 #define VECTOR_SEARCH_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include "common.h"
 
@@ -232,6 +233,176 @@ inline size_t vector_find_last_z(
     size_t z)
   __attribute__((nonnull(1, 3), pure));
 
+/**
+ * @brief Find the first element in the @a vector whose bytes are equal to the
+ *   bytes of @a elmt
+ *
+ * This is vector_find() with an equality function that compares each byte of
+ * the element, except that the elements are compared directly rather than
+ * through a function call per element. When the element size is 1, 2, 4, 8
+ * or 16 then a block of elements is compared at a time, with AVX2 if the
+ * processor supports it or with SSE2 if the library is built for it.
+ * Otherwise each element is compared with memcmp().
+ *
+ * This is only meaningful for elements where equal values have equal bytes.
+ * That excludes floating point numbers (where @c 0.0 equals @c -0.0) and
+ * structures with padding, for example.
+ *
+ * @param vector the vector to operate on
+ * @param elmt the location of the element to search for
+ * @return the index of the element on success; otherwise @c SIZE_MAX
+ *
+ * @see vector_find_value_z() - the explicit interface analogue
+ */
+//= size_t vector_find_value(vector_c vector, const void *elmt)
+#define vector_find_value(v, ...) \
+  vector_find_value_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Find the first element in the @a vector whose bytes are equal to the
+ *   bytes of @a elmt
+ *
+ * This is vector_find_z() with an equality function that compares each byte
+ * of the element, except that the elements are compared directly rather than
+ * through a function call per element. When the element size is 1, 2, 4, 8
+ * or 16 then a block of elements is compared at a time, with AVX2 if the
+ * processor supports it or with SSE2 if the library is built for it.
+ * Otherwise each element is compared with memcmp().
+ *
+ * This is only meaningful for elements where equal values have equal bytes.
+ * That excludes floating point numbers (where @c 0.0 equals @c -0.0) and
+ * structures with padding, for example.
+ *
+ * @param vector the vector to operate on
+ * @param elmt the location of the element to search for
+ * @param z the element size of the @a vector
+ * @return the index of the element on success; otherwise @c SIZE_MAX
+ *
+ * @see vector_find_value() - the implicit interface analogue
+ */
+size_t vector_find_value_z(vector_c vector, const void *elmt, size_t z)
+  __attribute__((nonnull, pure));
+
+/**
+ * @brief Find the first element at or after index @a i in the @a vector whose
+ *   bytes are equal to the bytes of @a elmt
+ *
+ * This is vector_find_next() with an equality function that compares each
+ * byte of the element, except that the elements are compared directly rather
+ * than through a function call per element. When the element size is 1, 2,
+ * 4, 8 or 16 then a block of elements is compared at a time, with AVX2
+ * if the processor supports it or with SSE2 if the library is built for it.
+ * Otherwise each element is compared with memcmp().
+ *
+ * This is only meaningful for elements where equal values have equal bytes.
+ * That excludes floating point numbers (where @c 0.0 equals @c -0.0) and
+ * structures with padding, for example.
+ *
+ * If @a i is neither an index in the @a vector or its @length then the behavior
+ * is undefined. As a special case if @a i is the <em>vector</em>'s length, then
+ * will return @c SIZE_MAX.
+ *
+ * @param vector the vector to operate on
+ * @param i the lowest index in the @a vector to consider
+ * @param elmt the location of the element to search for
+ * @return the index of the element on success; otherwise @c SIZE_MAX
+ *
+ * @see vector_find_value_next_z() - the explicit interface analogue
+ */
+//= size_t vector_find_value_next(vector_c vector, size_t i, const void *elmt)
+#define vector_find_value_next(v, ...) \
+  vector_find_value_next_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Find the first element at or after index @a i in the @a vector whose
+ *   bytes are equal to the bytes of @a elmt
+ *
+ * This is vector_find_next_z() with an equality function that compares each
+ * byte of the element, except that the elements are compared directly rather
+ * than through a function call per element. When the element size is 1, 2,
+ * 4, 8 or 16 then a block of elements is compared at a time, with AVX2
+ * if the processor supports it or with SSE2 if the library is built for it.
+ * Otherwise each element is compared with memcmp().
+ *
+ * This is only meaningful for elements where equal values have equal bytes.
+ * That excludes floating point numbers (where @c 0.0 equals @c -0.0) and
+ * structures with padding, for example.
+ *
+ * If @a i is neither an index in the @a vector or its @length then the behavior
+ * is undefined. As a special case if @a i is the <em>vector</em>'s length, then
+ * will return @c SIZE_MAX.
+ *
+ * @param vector the vector to operate on
+ * @param i the lowest index in the @a vector to consider
+ * @param elmt the location of the element to search for
+ * @param z the element size of the @a vector
+ * @return the index of the element on success; otherwise @c SIZE_MAX
+ *
+ * @see vector_find_value_next() - the implicit interface analogue
+ */
+size_t vector_find_value_next_z(
+    vector_c vector, size_t i, const void *elmt, size_t z)
+  __attribute__((nonnull, pure));
+
+/**
+ * @brief Find the last element before index @a i in the @a vector whose bytes
+ *   are equal to the bytes of @a elmt
+ *
+ * This is vector_find_last() with an equality function that compares each
+ * byte of the element, except that the elements are compared directly rather
+ * than through a function call per element. When the element size is 1, 2,
+ * 4, 8 or 16 then a block of elements is compared at a time, with AVX2
+ * if the processor supports it or with SSE2 if the library is built for it.
+ * Otherwise each element is compared with memcmp().
+ *
+ * This is only meaningful for elements where equal values have equal bytes.
+ * That excludes floating point numbers (where @c 0.0 equals @c -0.0) and
+ * structures with padding, for example.
+ *
+ * If @a i is neither an index in the @a vector or its @length then the behavior
+ * is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param i the index in or just after the @a vector to search before
+ * @param elmt the location of the element to search for
+ * @return the index of the element on success; otherwise @c SIZE_MAX
+ *
+ * @see vector_find_value_last_z() - the explicit interface analogue
+ */
+//= size_t vector_find_value_last(vector_c vector, size_t i, const void *elmt)
+#define vector_find_value_last(v, ...) \
+  vector_find_value_last_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Find the last element before index @a i in the @a vector whose bytes
+ *   are equal to the bytes of @a elmt
+ *
+ * This is vector_find_last_z() with an equality function that compares each
+ * byte of the element, except that the elements are compared directly rather
+ * than through a function call per element. When the element size is 1, 2,
+ * 4, 8 or 16 then a block of elements is compared at a time, with AVX2
+ * if the processor supports it or with SSE2 if the library is built for it.
+ * Otherwise each element is compared with memcmp().
+ *
+ * This is only meaningful for elements where equal values have equal bytes.
+ * That excludes floating point numbers (where @c 0.0 equals @c -0.0) and
+ * structures with padding, for example.
+ *
+ * If @a i is neither an index in the @a vector or its @length then the behavior
+ * is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param i the index in or just after the @a vector to search before
+ * @param elmt the location of the element to search for
+ * @param z the element size of the @a vector
+ * @return the index of the element on success; otherwise @c SIZE_MAX
+ *
+ * @see vector_find_value_last() - the implicit interface analogue
+ */
+size_t vector_find_value_last_z(
+    vector_c vector, size_t i, const void *elmt, size_t z)
+  __attribute__((nonnull, pure));
+
 /**
  * @brief Find the first element in the sorted @a vector equal to @a elmt
  *
@@ -245,9 +416,17 @@ inline size_t vector_find_last_z(
  * The behavior is undefined if the @a vector is not already partitioned with
  * respect to @a elmt in ascending order according to @a cmpf.
  *
+ * This is vector_lower_bound() followed by a comparison of the element at the
+ * lower bound with @a elmt, so it makes about <code>log2(n) + 2</code>
+ * comparisons regardless of how many elements are equal to @a elmt.
+ *
+ * As with bsearch(), @a cmpf is passed @a elmt first, so the type of the key
+ * may differ from the type of the elements.
+ *
  * @param vector the vector to operate on
  * @param elmt the element to search for
- * @param cmpf the function to use to determine equality
+ * @param cmpf the function to compare @a elmt (as @a a) with an element of the
+ *   @a vector (as @a b)
  * @return the index of the element on success; otherwise @c SIZE_MAX
  *
  * @see vector_search_z() The equivalent operation in the explicit interface
@@ -265,6 +444,569 @@ inline size_t vector_search_z(
     size_t z)
   __attribute__((nonnull(1, 3), pure));
 
+/**
+ * @brief Find the index of the first element in the sorted @a vector that
+ *   doesn't compare less than @a elmt
+ *
+ * The @a vector must be partitioned with respect to @a elmt according to
+ * @a cmpf. That is, all the elements that compare less than must appear before
+ * all the elements that compare equal to, and those must appear before all the
+ * elements that compare greater than @a elmt according to @a cmpf. A vector
+ * sorted by a previous call to vector_sort() with the same @a cmpf satisfies
+ * these requirements. Otherwise the behavior is undefined.
+ *
+ * If every element compares less than @a elmt then this will return the length
+ * of the @a vector. In either case this is the index that @a elmt can be
+ * inserted at to keep the @a vector sorted, before any elements equal to it.
+ *
+ * This is a binary search that makes about <code>log2(n) + 1</code> comparisons
+ * for any @a vector of length @c n, regardless of how many elements are equal
+ * to @a elmt. Each step picks a half with a conditional move rather than a
+ * branch on the result of the comparison.
+ *
+ * @param vector the vector to operate on
+ * @param elmt the element to search for
+ * @param cmpf the function to compare @a elmt (as @a a) with an element of the
+ *   @a vector (as @a b)
+ * @return the index of the element, or the length of the @a vector
+ *
+ * @see vector_lower_bound_z() - the explicit interface analogue
+ */
+//= size_t vector_lower_bound(
+//=     vector_c vector,
+//=     const void *elmt,
+//=     int (*cmpf)(const void *a, const void *b))
+#define vector_lower_bound(v, ...) \
+  vector_lower_bound_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Find the index of the first element in the sorted @a vector that
+ *   doesn't compare less than @a elmt
+ *
+ * The @a vector must be partitioned with respect to @a elmt according to
+ * @a cmpf. That is, all the elements that compare less than must appear before
+ * all the elements that compare equal to, and those must appear before all the
+ * elements that compare greater than @a elmt according to @a cmpf. A vector
+ * sorted by a previous call to vector_sort() with the same @a cmpf satisfies
+ * these requirements. Otherwise the behavior is undefined.
+ *
+ * If every element compares less than @a elmt then this will return the length
+ * of the @a vector. In either case this is the index that @a elmt can be
+ * inserted at to keep the @a vector sorted, before any elements equal to it.
+ *
+ * This is a binary search that makes about <code>log2(n) + 1</code> comparisons
+ * for any @a vector of length @c n, regardless of how many elements are equal
+ * to @a elmt. Each step picks a half with a conditional move rather than a
+ * branch on the result of the comparison.
+ *
+ * @param vector the vector to operate on
+ * @param elmt the element to search for
+ * @param cmpf the function to compare @a elmt (as @a a) with an element of the
+ *   @a vector (as @a b)
+ * @param z the element size of the @a vector
+ * @return the index of the element, or the length of the @a vector
+ *
+ * @see vector_lower_bound() - the implicit interface analogue
+ */
+inline size_t vector_lower_bound_z(
+    vector_c vector,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b),
+    size_t z)
+  __attribute__((nonnull(1, 3), pure));
+
+/**
+ * @brief Find the index of the first element in the sorted @a vector that
+ *   doesn't compare less than @a elmt
+ *
+ * The @a vector must be partitioned with respect to @a elmt according to
+ * @a cmpf. That is, all the elements that compare less than must appear before
+ * all the elements that compare equal to, and those must appear before all the
+ * elements that compare greater than @a elmt according to @a cmpf. A vector
+ * sorted by a previous call to vector_sort() with the same @a cmpf satisfies
+ * these requirements. Otherwise the behavior is undefined.
+ *
+ * If every element compares less than @a elmt then this will return the length
+ * of the @a vector. In either case this is the index that @a elmt can be
+ * inserted at to keep the @a vector sorted, before any elements equal to it.
+ *
+ * This is a binary search that makes about <code>log2(n) + 1</code> comparisons
+ * for any @a vector of length @c n, regardless of how many elements are equal
+ * to @a elmt. Each step picks a half with a conditional move rather than a
+ * branch on the result of the comparison.
+ *
+ * @param vector the vector to operate on
+ * @param elmt the element to search for
+ * @param cmpf the function to compare @a elmt (as @a a) with an element of the
+ *   @a vector (as @a b) and @a data
+ * @param data contextual information to pass as the last argument to @a cmpf
+ * @return the index of the element, or the length of the @a vector
+ *
+ * @see vector_lower_bound_with_z() - the explicit interface analogue
+ */
+//= size_t vector_lower_bound_with(
+//=     vector_c vector,
+//=     const void *elmt,
+//=     int (*cmpf)(const void *a, const void *b, void *data),
+//=     void *data)
+#define vector_lower_bound_with(v, ...) \
+  vector_lower_bound_with_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Find the index of the first element in the sorted @a vector that
+ *   doesn't compare less than @a elmt
+ *
+ * The @a vector must be partitioned with respect to @a elmt according to
+ * @a cmpf. That is, all the elements that compare less than must appear before
+ * all the elements that compare equal to, and those must appear before all the
+ * elements that compare greater than @a elmt according to @a cmpf. A vector
+ * sorted by a previous call to vector_sort() with the same @a cmpf satisfies
+ * these requirements. Otherwise the behavior is undefined.
+ *
+ * If every element compares less than @a elmt then this will return the length
+ * of the @a vector. In either case this is the index that @a elmt can be
+ * inserted at to keep the @a vector sorted, before any elements equal to it.
+ *
+ * This is a binary search that makes about <code>log2(n) + 1</code> comparisons
+ * for any @a vector of length @c n, regardless of how many elements are equal
+ * to @a elmt. Each step picks a half with a conditional move rather than a
+ * branch on the result of the comparison.
+ *
+ * @param vector the vector to operate on
+ * @param elmt the element to search for
+ * @param cmpf the function to compare @a elmt (as @a a) with an element of the
+ *   @a vector (as @a b) and @a data
+ * @param data contextual information to pass as the last argument to @a cmpf
+ * @param z the element size of the @a vector
+ * @return the index of the element, or the length of the @a vector
+ *
+ * @see vector_lower_bound_with() - the implicit interface analogue
+ */
+inline size_t vector_lower_bound_with_z(
+    vector_c vector,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b, void *data),
+    void *data,
+    size_t z)
+  __attribute__((nonnull(1, 3), pure));
+
+/**
+ * @brief Find the index of the first element in the sorted @a vector that
+ *   compares greater than @a elmt
+ *
+ * The @a vector must be partitioned with respect to @a elmt according to
+ * @a cmpf. That is, all the elements that compare less than must appear before
+ * all the elements that compare equal to, and those must appear before all the
+ * elements that compare greater than @a elmt according to @a cmpf. A vector
+ * sorted by a previous call to vector_sort() with the same @a cmpf satisfies
+ * these requirements. Otherwise the behavior is undefined.
+ *
+ * If no element compares greater than @a elmt then this will return the length
+ * of the @a vector. In either case this is the index that @a elmt can be
+ * inserted at to keep the @a vector sorted, after any elements equal to it.
+ *
+ * This is a binary search that makes about <code>log2(n) + 1</code> comparisons
+ * for any @a vector of length @c n, regardless of how many elements are equal
+ * to @a elmt. Each step picks a half with a conditional move rather than a
+ * branch on the result of the comparison.
+ *
+ * @param vector the vector to operate on
+ * @param elmt the element to search for
+ * @param cmpf the function to compare @a elmt (as @a a) with an element of the
+ *   @a vector (as @a b)
+ * @return the index of the element, or the length of the @a vector
+ *
+ * @see vector_upper_bound_z() - the explicit interface analogue
+ */
+//= size_t vector_upper_bound(
+//=     vector_c vector,
+//=     const void *elmt,
+//=     int (*cmpf)(const void *a, const void *b))
+#define vector_upper_bound(v, ...) \
+  vector_upper_bound_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Find the index of the first element in the sorted @a vector that
+ *   compares greater than @a elmt
+ *
+ * The @a vector must be partitioned with respect to @a elmt according to
+ * @a cmpf. That is, all the elements that compare less than must appear before
+ * all the elements that compare equal to, and those must appear before all the
+ * elements that compare greater than @a elmt according to @a cmpf. A vector
+ * sorted by a previous call to vector_sort() with the same @a cmpf satisfies
+ * these requirements. Otherwise the behavior is undefined.
+ *
+ * If no element compares greater than @a elmt then this will return the length
+ * of the @a vector. In either case this is the index that @a elmt can be
+ * inserted at to keep the @a vector sorted, after any elements equal to it.
+ *
+ * This is a binary search that makes about <code>log2(n) + 1</code> comparisons
+ * for any @a vector of length @c n, regardless of how many elements are equal
+ * to @a elmt. Each step picks a half with a conditional move rather than a
+ * branch on the result of the comparison.
+ *
+ * @param vector the vector to operate on
+ * @param elmt the element to search for
+ * @param cmpf the function to compare @a elmt (as @a a) with an element of the
+ *   @a vector (as @a b)
+ * @param z the element size of the @a vector
+ * @return the index of the element, or the length of the @a vector
+ *
+ * @see vector_upper_bound() - the implicit interface analogue
+ */
+inline size_t vector_upper_bound_z(
+    vector_c vector,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b),
+    size_t z)
+  __attribute__((nonnull(1, 3), pure));
+
+/**
+ * @brief Find the index of the first element in the sorted @a vector that
+ *   compares greater than @a elmt
+ *
+ * The @a vector must be partitioned with respect to @a elmt according to
+ * @a cmpf. That is, all the elements that compare less than must appear before
+ * all the elements that compare equal to, and those must appear before all the
+ * elements that compare greater than @a elmt according to @a cmpf. A vector
+ * sorted by a previous call to vector_sort() with the same @a cmpf satisfies
+ * these requirements. Otherwise the behavior is undefined.
+ *
+ * If no element compares greater than @a elmt then this will return the length
+ * of the @a vector. In either case this is the index that @a elmt can be
+ * inserted at to keep the @a vector sorted, after any elements equal to it.
+ *
+ * This is a binary search that makes about <code>log2(n) + 1</code> comparisons
+ * for any @a vector of length @c n, regardless of how many elements are equal
+ * to @a elmt. Each step picks a half with a conditional move rather than a
+ * branch on the result of the comparison.
+ *
+ * @param vector the vector to operate on
+ * @param elmt the element to search for
+ * @param cmpf the function to compare @a elmt (as @a a) with an element of the
+ *   @a vector (as @a b) and @a data
+ * @param data contextual information to pass as the last argument to @a cmpf
+ * @return the index of the element, or the length of the @a vector
+ *
+ * @see vector_upper_bound_with_z() - the explicit interface analogue
+ */
+//= size_t vector_upper_bound_with(
+//=     vector_c vector,
+//=     const void *elmt,
+//=     int (*cmpf)(const void *a, const void *b, void *data),
+//=     void *data)
+#define vector_upper_bound_with(v, ...) \
+  vector_upper_bound_with_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Find the index of the first element in the sorted @a vector that
+ *   compares greater than @a elmt
+ *
+ * The @a vector must be partitioned with respect to @a elmt according to
+ * @a cmpf. That is, all the elements that compare less than must appear before
+ * all the elements that compare equal to, and those must appear before all the
+ * elements that compare greater than @a elmt according to @a cmpf. A vector
+ * sorted by a previous call to vector_sort() with the same @a cmpf satisfies
+ * these requirements. Otherwise the behavior is undefined.
+ *
+ * If no element compares greater than @a elmt then this will return the length
+ * of the @a vector. In either case this is the index that @a elmt can be
+ * inserted at to keep the @a vector sorted, after any elements equal to it.
+ *
+ * This is a binary search that makes about <code>log2(n) + 1</code> comparisons
+ * for any @a vector of length @c n, regardless of how many elements are equal
+ * to @a elmt. Each step picks a half with a conditional move rather than a
+ * branch on the result of the comparison.
+ *
+ * @param vector the vector to operate on
+ * @param elmt the element to search for
+ * @param cmpf the function to compare @a elmt (as @a a) with an element of the
+ *   @a vector (as @a b) and @a data
+ * @param data contextual information to pass as the last argument to @a cmpf
+ * @param z the element size of the @a vector
+ * @return the index of the element, or the length of the @a vector
+ *
+ * @see vector_upper_bound_with() - the implicit interface analogue
+ */
+inline size_t vector_upper_bound_with_z(
+    vector_c vector,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b, void *data),
+    void *data,
+    size_t z)
+  __attribute__((nonnull(1, 3), pure));
+
+/**
+ * @brief Find the range of the elements in the sorted @a vector that compare
+ *   equal to @a elmt
+ *
+ * The @a vector must be partitioned with respect to @a elmt according to
+ * @a cmpf. That is, all the elements that compare less than must appear before
+ * all the elements that compare equal to, and those must appear before all the
+ * elements that compare greater than @a elmt according to @a cmpf. A vector
+ * sorted by a previous call to vector_sort() with the same @a cmpf satisfies
+ * these requirements. Otherwise the behavior is undefined.
+ *
+ * This will return the index of the first element equal to @a elmt (the lower
+ * bound) and store the index after the last element equal to @a elmt (the upper
+ * bound) at @a end. If no element is equal to @a elmt then both are the index
+ * that @a elmt can be inserted at to keep the @a vector sorted.
+ *
+ * This is a binary search for the lower bound followed by a binary search for
+ * the upper bound after it, each as in vector_lower_bound(), so it makes about
+ * <code>2 log2(n) + 2</code> comparisons regardless of how many elements are
+ * equal to @a elmt.
+ *
+ * @param vector the vector to operate on
+ * @param elmt the element to search for
+ * @param cmpf the function to compare @a elmt (as @a a) with an element of the
+ *   @a vector (as @a b)
+ * @param end the location to store the upper bound at
+ * @return the lower bound
+ *
+ * @see vector_equal_range_z() - the explicit interface analogue
+ */
+//= size_t vector_equal_range(
+//=     vector_c vector,
+//=     const void *elmt,
+//=     int (*cmpf)(const void *a, const void *b),
+//=     size_t *end)
+#define vector_equal_range(v, ...) \
+  vector_equal_range_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Find the range of the elements in the sorted @a vector that compare
+ *   equal to @a elmt
+ *
+ * The @a vector must be partitioned with respect to @a elmt according to
+ * @a cmpf. That is, all the elements that compare less than must appear before
+ * all the elements that compare equal to, and those must appear before all the
+ * elements that compare greater than @a elmt according to @a cmpf. A vector
+ * sorted by a previous call to vector_sort() with the same @a cmpf satisfies
+ * these requirements. Otherwise the behavior is undefined.
+ *
+ * This will return the index of the first element equal to @a elmt (the lower
+ * bound) and store the index after the last element equal to @a elmt (the upper
+ * bound) at @a end. If no element is equal to @a elmt then both are the index
+ * that @a elmt can be inserted at to keep the @a vector sorted.
+ *
+ * This is a binary search for the lower bound followed by a binary search for
+ * the upper bound after it, each as in vector_lower_bound(), so it makes about
+ * <code>2 log2(n) + 2</code> comparisons regardless of how many elements are
+ * equal to @a elmt.
+ *
+ * @param vector the vector to operate on
+ * @param elmt the element to search for
+ * @param cmpf the function to compare @a elmt (as @a a) with an element of the
+ *   @a vector (as @a b)
+ * @param end the location to store the upper bound at
+ * @param z the element size of the @a vector
+ * @return the lower bound
+ *
+ * @see vector_equal_range() - the implicit interface analogue
+ */
+inline size_t vector_equal_range_z(
+    vector_c vector,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b),
+    size_t *end,
+    size_t z)
+  __attribute__((nonnull(1, 3, 4)));
+
+/**
+ * @brief Find the range of the elements in the sorted @a vector that compare
+ *   equal to @a elmt
+ *
+ * The @a vector must be partitioned with respect to @a elmt according to
+ * @a cmpf. That is, all the elements that compare less than must appear before
+ * all the elements that compare equal to, and those must appear before all the
+ * elements that compare greater than @a elmt according to @a cmpf. A vector
+ * sorted by a previous call to vector_sort() with the same @a cmpf satisfies
+ * these requirements. Otherwise the behavior is undefined.
+ *
+ * This will return the index of the first element equal to @a elmt (the lower
+ * bound) and store the index after the last element equal to @a elmt (the upper
+ * bound) at @a end. If no element is equal to @a elmt then both are the index
+ * that @a elmt can be inserted at to keep the @a vector sorted.
+ *
+ * This is a binary search for the lower bound followed by a binary search for
+ * the upper bound after it, each as in vector_lower_bound(), so it makes about
+ * <code>2 log2(n) + 2</code> comparisons regardless of how many elements are
+ * equal to @a elmt.
+ *
+ * @param vector the vector to operate on
+ * @param elmt the element to search for
+ * @param cmpf the function to compare @a elmt (as @a a) with an element of the
+ *   @a vector (as @a b) and @a data
+ * @param data contextual information to pass as the last argument to @a cmpf
+ * @param end the location to store the upper bound at
+ * @return the lower bound
+ *
+ * @see vector_equal_range_with_z() - the explicit interface analogue
+ */
+//= size_t vector_equal_range_with(
+//=     vector_c vector,
+//=     const void *elmt,
+//=     int (*cmpf)(const void *a, const void *b, void *data),
+//=     void *data,
+//=     size_t *end)
+#define vector_equal_range_with(v, ...) \
+  vector_equal_range_with_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Find the range of the elements in the sorted @a vector that compare
+ *   equal to @a elmt
+ *
+ * The @a vector must be partitioned with respect to @a elmt according to
+ * @a cmpf. That is, all the elements that compare less than must appear before
+ * all the elements that compare equal to, and those must appear before all the
+ * elements that compare greater than @a elmt according to @a cmpf. A vector
+ * sorted by a previous call to vector_sort() with the same @a cmpf satisfies
+ * these requirements. Otherwise the behavior is undefined.
+ *
+ * This will return the index of the first element equal to @a elmt (the lower
+ * bound) and store the index after the last element equal to @a elmt (the upper
+ * bound) at @a end. If no element is equal to @a elmt then both are the index
+ * that @a elmt can be inserted at to keep the @a vector sorted.
+ *
+ * This is a binary search for the lower bound followed by a binary search for
+ * the upper bound after it, each as in vector_lower_bound(), so it makes about
+ * <code>2 log2(n) + 2</code> comparisons regardless of how many elements are
+ * equal to @a elmt.
+ *
+ * @param vector the vector to operate on
+ * @param elmt the element to search for
+ * @param cmpf the function to compare @a elmt (as @a a) with an element of the
+ *   @a vector (as @a b) and @a data
+ * @param data contextual information to pass as the last argument to @a cmpf
+ * @param end the location to store the upper bound at
+ * @param z the element size of the @a vector
+ * @return the lower bound
+ *
+ * @see vector_equal_range_with() - the implicit interface analogue
+ */
+inline size_t vector_equal_range_with_z(
+    vector_c vector,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b, void *data),
+    void *data,
+    size_t *end,
+    size_t z)
+  __attribute__((nonnull(1, 3, 5)));
+
+/**
+ * @brief Find the first element in the sorted @a vector equal to each of
+ *   @a nkeys keys in @a keys
+ *
+ * This stores in <code>out[k]</code> the index that vector_search() would
+ * return for the key at index @c k in @a keys, but does the searches together
+ * so that the latency of memory is paid for many of them at once rather than
+ * once per search:
+ *
+ * - If @a keys is sorted according to @a cmpf then the @a vector is walked
+ *   once from the head to the tail. The search for each key starts at the
+ *   result for the key before it and gallops toward the tail, so a key near
+ *   the key before it is found in a few comparisons.
+ * - Otherwise the binary searches for each group of keys are run in
+ *   lock-step. Each compare prefetches the element that the next step of its
+ *   search will compare so that the loads of the group overlap.
+ *
+ * Checking whether @a keys is sorted makes @a nkeys - 1 extra comparisons.
+ * The @a vector must be partitioned with respect to each key as in
+ * vector_search(). Otherwise the behavior is undefined. As the keys are also
+ * compared with each other, @a cmpf is passed a key as either argument then.
+ *
+ * @param vector the vector to operate on
+ * @param keys the location of the elements to search for
+ * @param nkeys the number of elements in @a keys
+ * @param cmpf the function to compare a key (as @a a) with an element of the
+ *   @a vector (as @a b)
+ * @param out the location to store the index of each key at
+ *
+ * @see vector_search_many_z() - the explicit interface analogue
+ */
+//= void vector_search_many(
+//=     vector_c vector,
+//=     const void *keys,
+//=     size_t nkeys,
+//=     int (*cmpf)(const void *a, const void *b),
+//=     size_t *out)
+#define vector_search_many(v, ...) \
+  vector_search_many_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Find the first element in the sorted @a vector equal to each of
+ *   @a nkeys keys in @a keys
+ *
+ * This stores in <code>out[k]</code> the index that vector_search_z() would
+ * return for the key at index @c k in @a keys. See vector_search_many() for a
+ * description of how the searches are done together.
+ *
+ * @param vector the vector to operate on
+ * @param keys the location of the elements to search for
+ * @param nkeys the number of elements in @a keys
+ * @param cmpf the function to compare a key (as @a a) with an element of the
+ *   @a vector (as @a b)
+ * @param out the location to store the index of each key at
+ * @param z the element size of the @a vector
+ *
+ * @see vector_search_many() - the implicit interface analogue
+ */
+inline void vector_search_many_z(
+    vector_c vector,
+    const void *keys,
+    size_t nkeys,
+    int (*cmpf)(const void *a, const void *b),
+    size_t *out,
+    size_t z)
+  __attribute__((nonnull(1, 4)));
+
+/// @cond INTERNAL
+
+/// The number of searches run in lock-step by vector_search_many_z()
+#define __VECTOR_SEARCH_GROUP 16
+
+/// Return whether the @a nkeys keys in @a keys are sorted according to @a cmpf
+inline _Bool __vector_sorted(
+    const void *keys,
+    size_t nkeys,
+    int (*cmpf)(const void *a, const void *b),
+    size_t z)
+  __attribute__((nonnull(3), pure));
+
+/// vector_search_many_z() with sorted @a keys
+inline void __vector_search_merge_z(
+    vector_c vector,
+    const void *keys,
+    size_t nkeys,
+    int (*cmpf)(const void *a, const void *b),
+    size_t *out,
+    size_t z)
+  __attribute__((nonnull(1, 4)));
+
+/**
+ * @brief Find the index of the first element at or after index @a i and before
+ *   index @a j in the sorted @a vector that compares greater than (or if
+ *   @a upper is false, not less than) @a elmt, or @a j if there's no such
+ *   element
+ *
+ * The element is compared with @a cmpf if it isn't @c NULL. Otherwise it's
+ * compared with @a cmpf_with and @a data.
+ */
+inline size_t __vector_bound_z(
+    vector_c vector,
+    size_t i,
+    size_t j,
+    const void *elmt,
+    int (*cmpf)(const void *a, const void *b),
+    int (*cmpf_with)(const void *a, const void *b, void *data),
+    void *data,
+    _Bool upper,
+    size_t z)
+  __attribute__((nonnull(1), pure));
+
+/// @endcond
+
 #ifdef VECTOR_TEST
 #undef inline
 #endif /* VECTOR_TEST */
@@ -4,27 +4,61 @@
 #define VECTOR_SHIFT_C
 
 #include <stddef.h>
+#include <string.h>
 
 #include "common.h"
 #include "access.h"
+#include "insert.h"
 #include "remove.h"
+#include "ring.h"
 
 #ifdef VECTOR_TEST
 #define inline
 #endif /* VECTOR_TEST */
 
 inline vector_t vector_pull_z(vector_t vector, void *elmt, size_t z) {
+  size_t length = vector_length(vector) - 1;
+
+  if (vector_ringed(vector)) {
+    if (elmt != NULL)
+      memcpy(elmt, vector_ring_at(vector, length, z), z);
+    return vector_truncate_z(vector, length, z);
+  }
+
   if (elmt != NULL)
-    vector_get(vector, vector_length(vector) - 1, elmt, z);
-  return vector_remove_z(vector, vector_length(vector) - 1, z);
+    vector_get(vector, length, elmt, z);
+  return vector_remove_z(vector, length, z);
 }
 
 inline vector_t vector_shift_z(vector_t vector, void *elmt, size_t z) {
+  if (vector_ringed(vector)) {
+    struct __vector_header_t *header = __vector_to_header(vector);
+    size_t length = header->length - 1;
+
+    if (elmt != NULL)
+      memcpy(elmt, vector_ring_at(vector, 0, z), z);
+
+    // Advance the head past the element which leaves it as the last element of
+    // the ring to be truncated. An empty ring starts at its storage again.
+    if (length == 0)
+      header->head = 0;
+    else if (++header->head == header->volume)
+      header->head = 0;
+    return vector_truncate_z(vector, length, z);
+  }
+
   if (elmt != NULL)
     vector_get(vector, 0, elmt, z);
   return vector_remove_z(vector, 0, z);
 }
 
+inline vector_t vector_unshift_z(
+    vector_t vector, const void *restrict elmt, size_t z) {
+  if (vector_ringed(vector))
+    return __vector_ring_unshift_z(vector, elmt, z);
+  return vector_insert_z(vector, 0, elmt, z);
+}
+
 #ifdef VECTOR_TEST
 #undef inline
 #endif /* VECTOR_TEST */
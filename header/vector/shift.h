@@ -25,6 +25,7 @@
  * that <code>length <= (volume - 1) / 2</code>, a vector_resize() will be
  * attempted to reduce the @volume to:
  *   @f[ volume = \frac{length \times 6 + 4}{5} @f]
+ * This is the default which the @ref vector_policy_t of the vector can change.
  * On success the shrunk vector will be returned. Otherwise the vector will be
  * returned as is (without the element).
  *
@@ -47,6 +48,7 @@
  * that <code>length <= (volume - 1) / 2</code>, a vector_resize_z() will be
  * attempted to reduce the @volume to:
  *   @f[ volume = \frac{length \times 6 + 4}{5} @f]
+ * This is the default which the @ref vector_policy_t of the vector can change.
  * On success the shrunk vector will be returned. Otherwise the vector will be
  * returned as is (without the element).
  *
@@ -65,7 +67,8 @@ inline vector_t vector_pull_z(vector_t vector, void *elmt, size_t z)
  * @brief Copy the first element in the @a vector to @a elmt and remove it
  *
  * All elements after the first are shifted one element toward the head of the
- * @a vector.
+ * @a vector. If the @a vector is a ring (see vector_ring()) then no element is
+ * moved; instead its first element is advanced past the removed element.
  *
  * If @a elmt is @c NULL then the element won't be copied before it's removed.
  *
@@ -73,6 +76,7 @@ inline vector_t vector_pull_z(vector_t vector, void *elmt, size_t z)
  * @length of the @a vector is reduced such that <code>length <= (volume - 1) /
  * 2</code>, a vector_resize_z() will be attempted to reduce the @volume to:
  *   @f[ volume = \frac{length \times 6 + 4}{5} @f]
+ * This is the default which the @ref vector_policy_t of the vector can change.
  * On success the shrunk vector will be returned. Otherwise the vector will be
  * returned as is (without the element).
  *
@@ -90,7 +94,8 @@ inline vector_t vector_pull_z(vector_t vector, void *elmt, size_t z)
  * @brief Copy the first element in the @a vector to @a elmt and remove it
  *
  * All elements after the first are shifted one element toward the head of the
- * @a vector.
+ * @a vector. If the @a vector is a ring (see vector_ring()) then no element is
+ * moved; instead its first element is advanced past the removed element.
  *
  * If @a elmt is @c NULL then the element won't be copied before it's removed.
  *
@@ -98,6 +103,7 @@ inline vector_t vector_pull_z(vector_t vector, void *elmt, size_t z)
  * @length of the @a vector is reduced such that <code>length <= (volume - 1) /
  * 2</code>, a vector_resize_z() will be attempted to reduce the @volume to:
  *   @f[ volume = \frac{length \times 6 + 4}{5} @f]
+ * This is the default which the @ref vector_policy_t of the vector can change.
  * On success the shrunk vector will be returned. Otherwise the vector will be
  * returned as is (without the element).
  *
@@ -112,6 +118,49 @@ inline vector_t vector_pull_z(vector_t vector, void *elmt, size_t z)
 inline vector_t vector_shift_z(vector_t vector, void *elmt, size_t z)
   __attribute__((nonnull(1), warn_unused_result));
 
+/**
+ * @brief Insert the data at @a elmt as the first element in the @a vector
+ *
+ * This is vector_insert() at index zero, which moves each element in the
+ * @a vector one element toward the tail. If the @a vector is a ring (see
+ * vector_ring()) then no element is moved; instead its first element is moved
+ * back one element in its storage, wrapping around to the end of its storage.
+ *
+ * If @a elmt is @c NULL then the inserted element will be uninitialized. If the
+ * insertion fails then @c NULL is returned as by vector_insert().
+ *
+ * @param vector the vector to operate on
+ * @param elmt the location of the element to insert
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_unshift_z() - the explicit interface analogue
+ */
+//= vector_t vector_unshift(vector_t vector, const void *restrict elmt)
+#define vector_unshift(v, ...) \
+  vector_unshift_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Insert the data at @a elmt as the first element in the @a vector
+ *
+ * This is vector_insert_z() at index zero, which moves each element in the
+ * @a vector one element toward the tail. If the @a vector is a ring (see
+ * vector_ring()) then no element is moved; instead its first element is moved
+ * back one element in its storage, wrapping around to the end of its storage.
+ *
+ * If @a elmt is @c NULL then the inserted element will be uninitialized. If the
+ * insertion fails then @c NULL is returned as by vector_insert_z().
+ *
+ * @param vector the vector to operate on
+ * @param elmt the location of the element to insert
+ * @param z the element size of the @a vector
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_unshift() - the implicit interface analogue
+ */
+inline vector_t vector_unshift_z(
+    vector_t vector, const void *restrict elmt, size_t z)
+  __attribute__((nonnull(1), warn_unused_result));
+
 #ifdef VECTOR_TEST
 #undef inline
 #endif /* VECTOR_TEST */
@@ -0,0 +1,40 @@
+/// @file header/vector/stats.c
+
+#ifndef VECTOR_STATS_C
+#define VECTOR_STATS_C
+
+#include <stddef.h>
+
+#include "common.h"
+#include "stats.h"
+
+#ifdef VECTOR_TEST
+#define inline
+#endif /* VECTOR_TEST */
+
+inline struct vector_stats_t vector_stats(void) {
+  return __vector_stats_local;
+}
+
+inline struct vector_stats_t vector_stats_global(void) {
+  struct vector_stats_t *global = &__vector_stats_global;
+
+  return (struct vector_stats_t) {
+    .allocate = __atomic_load_n(&global->allocate, __ATOMIC_RELAXED),
+    .allocate_bytes =
+      __atomic_load_n(&global->allocate_bytes, __ATOMIC_RELAXED),
+    .reallocate = __atomic_load_n(&global->reallocate, __ATOMIC_RELAXED),
+    .reallocate_bytes =
+      __atomic_load_n(&global->reallocate_bytes, __ATOMIC_RELAXED),
+    .move_bytes = __atomic_load_n(&global->move_bytes, __ATOMIC_RELAXED),
+    .grow = __atomic_load_n(&global->grow, __ATOMIC_RELAXED),
+    .shrink = __atomic_load_n(&global->shrink, __ATOMIC_RELAXED),
+    .failure = __atomic_load_n(&global->failure, __ATOMIC_RELAXED),
+  };
+}
+
+#ifdef VECTOR_TEST
+#undef inline
+#endif /* VECTOR_TEST */
+
+#endif /* VECTOR_STATS_C */
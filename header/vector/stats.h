@@ -0,0 +1,80 @@
+/// @file header/vector/stats.h
+
+#ifndef VECTOR_STATS_H
+#define VECTOR_STATS_H
+
+#include <stddef.h>
+#include "common.h"
+
+#ifdef VECTOR_TEST
+#define inline
+#endif /* VECTOR_TEST */
+
+/**
+ * @brief The allocation and data movement counters of vector operations
+ *
+ * These are only counted when @c VECTOR_STATS is defined at build time (with
+ * the @c VECTOR_STATS CMake option). It must be defined the same in each
+ * translation unit, including those of the library itself. Otherwise each
+ * counter remains zero and counting costs nothing.
+ */
+struct vector_stats_t {
+  /// The number of allocations of a new vector
+  size_t allocate;
+  /// The total size in bytes requested by each allocation
+  size_t allocate_bytes;
+  /// The number of reallocations of an existing vector
+  size_t reallocate;
+  /// The total size in bytes requested by each reallocation
+  size_t reallocate_bytes;
+  /// The number of bytes moved by vector_inject_z() and vector_excise_z()
+  size_t move_bytes;
+  /// The number of resizes that increased the volume of a vector
+  size_t grow;
+  /// The number of resizes that reduced the volume of a vector
+  size_t shrink;
+  /// The number of allocations and reallocations that failed
+  size_t failure;
+};
+
+/// Return the counters of the operations in the calling thread
+inline struct vector_stats_t vector_stats(void);
+
+/// Return the counters of the operations in each thread
+inline struct vector_stats_t vector_stats_global(void);
+
+/// @cond INTERNAL
+
+/// The counters of the calling thread
+extern _Thread_local struct vector_stats_t __vector_stats_local;
+
+/// The counters of each thread which are updated atomically
+extern struct vector_stats_t __vector_stats_global;
+
+/**
+ * @brief Add @a n to the @a counter of the calling thread and of each thread
+ *
+ * This is a no-op unless @c VECTOR_STATS is defined.
+ */
+#ifdef VECTOR_STATS
+#define __vector_stats_add(counter, n) ({ \
+  size_t __vector_stats_n = (n); \
+  __vector_stats_local.counter += __vector_stats_n; \
+  __atomic_fetch_add( \
+      &__vector_stats_global.counter, __vector_stats_n, __ATOMIC_RELAXED); \
+})
+#else
+#define __vector_stats_add(counter, n) ((void) 0)
+#endif /* VECTOR_STATS */
+
+/// @endcond
+
+#ifdef VECTOR_TEST
+#undef inline
+#endif /* VECTOR_TEST */
+
+#endif /* VECTOR_STATS_H */
+
+#ifndef VECTOR_TEST
+#include "stats.c"
+#endif /* VECTOR_TEST */
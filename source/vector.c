@@ -1,27 +1,58 @@
 /// @file source/vector.c
 
 #include <stddef.h>
-#include <stdlib.h>
 #include <string.h>
 
 #include <vector/common.h>
+#include <vector/align.h>
+#include <vector/allocator.h>
+#include <vector/policy.h>
 
-vector_t vector_duplicate_z(vector_c source, size_t z) {
+/// Duplicate the @a source into an allocation from the @a allocator
+static vector_t duplicate(
+    vector_c source, const struct vector_allocator_t *allocator, size_t z) {
   struct __vector_header_t *header;
 
   size_t volume = vector_volume(source);
   size_t length = vector_length(source);
+  size_t size = sizeof(*header) + volume * z;
 
-  if ((header = malloc(sizeof(*header) + volume * z)) == NULL) {
+  if ((header = __vector_allocate(allocator, size)) == NULL) {
     if (length == volume)
       return NULL;
-    if ((header = malloc(sizeof(*header) + length * z)) == NULL)
+    size = sizeof(*header) + length * z;
+    if ((header = __vector_allocate(allocator, size)) == NULL)
       return NULL;
     header->volume = length;
   } else
     header->volume = volume;
 
   header->length = length;
+  header->size = size;
+  header->allocator = allocator;
+  header->policy = vector_policy(source);
+  header->head = 0;
+  header->flags = __vector_to_header(source)->flags;
+
+  // copy the elements of a ring up to the end of its storage and then any that
+  // wrap around to its start
+  size_t head = __vector_to_header(source)->head;
+  size_t n = volume - head < length ? volume - head : length;
+  memcpy(header->data, (const char *) source + head * z, n * z);
+  memcpy(header->data + n * z, source, (length - n) * z);
+
+  return header->data;
+}
+
+vector_t vector_duplicate_z(vector_c source, size_t z) {
+  return duplicate(source, vector_allocator(source), z);
+}
+
+vector_t vector_duplicate_aligned_z(
+    vector_c source, size_t alignment, size_t z) {
+  const struct vector_allocator_t *allocator;
 
-  return memcpy(header->data, source, length * z);
+  if ((allocator = vector_aligned(alignment)) == NULL)
+    return NULL;
+  return duplicate(source, allocator, z);
 }
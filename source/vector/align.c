@@ -0,0 +1,41 @@
+/// @file source/vector/align.c
+
+#include <vector/align.c>
+
+/// The alignment of each aligned allocator
+static size_t alignment[] = {
+  (size_t) 1 << 0, (size_t) 1 << 1, (size_t) 1 << 2, (size_t) 1 << 3,
+  (size_t) 1 << 4, (size_t) 1 << 5, (size_t) 1 << 6, (size_t) 1 << 7,
+  (size_t) 1 << 8, (size_t) 1 << 9, (size_t) 1 << 10, (size_t) 1 << 11,
+  (size_t) 1 << 12, (size_t) 1 << 13, (size_t) 1 << 14, (size_t) 1 << 15,
+  (size_t) 1 << 16,
+};
+
+_Static_assert(
+    sizeof(alignment) / sizeof(alignment[0]) == 17
+    && VECTOR_ALIGNMENT_LIMIT == (size_t) 1 << 16,
+    "the aligned allocators must cover each alignment up to the limit");
+
+#define ALIGNED(i) { \
+  .allocate = __vector_aligned_allocate, \
+  .reallocate = __vector_aligned_reallocate, \
+  .deallocate = __vector_aligned_deallocate, \
+  .context = &alignment[i], \
+  .usable = NULL, \
+}
+
+const struct vector_allocator_t __vector_aligned[] = {
+  ALIGNED(0), ALIGNED(1), ALIGNED(2), ALIGNED(3),
+  ALIGNED(4), ALIGNED(5), ALIGNED(6), ALIGNED(7),
+  ALIGNED(8), ALIGNED(9), ALIGNED(10), ALIGNED(11),
+  ALIGNED(12), ALIGNED(13), ALIGNED(14), ALIGNED(15),
+  ALIGNED(16),
+};
+
+extern __typeof__(vector_aligned) vector_aligned;
+extern __typeof__(vector_create_aligned) vector_create_aligned;
+extern __typeof__(vector_import_aligned_z) vector_import_aligned_z;
+extern __typeof__(__vector_aligned_offset) __vector_aligned_offset;
+extern __typeof__(__vector_aligned_allocate) __vector_aligned_allocate;
+extern __typeof__(__vector_aligned_reallocate) __vector_aligned_reallocate;
+extern __typeof__(__vector_aligned_deallocate) __vector_aligned_deallocate;
@@ -0,0 +1,9 @@
+/// @file source/vector/allocator.c
+
+#include <vector/allocator.c>
+
+extern __typeof__(vector_allocator) vector_allocator;
+extern __typeof__(__vector_allocate) __vector_allocate;
+extern __typeof__(__vector_reallocate) __vector_reallocate;
+extern __typeof__(__vector_deallocate) __vector_deallocate;
+extern __typeof__(__vector_usable) __vector_usable;
@@ -0,0 +1,12 @@
+/// @file source/vector/arena.c
+
+#include <vector/arena.c>
+
+extern __typeof__(vector_arena_create) vector_arena_create;
+extern __typeof__(vector_arena_reset) vector_arena_reset;
+extern __typeof__(vector_arena_delete) vector_arena_delete;
+extern __typeof__(vector_create_in) vector_create_in;
+extern __typeof__(vector_import_in_z) vector_import_in_z;
+extern __typeof__(__vector_arena_allocate) __vector_arena_allocate;
+extern __typeof__(__vector_arena_reallocate) __vector_arena_reallocate;
+extern __typeof__(__vector_arena_deallocate) __vector_arena_deallocate;
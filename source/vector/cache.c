@@ -0,0 +1,21 @@
+/// @file source/vector/cache.c
+
+#include <vector/cache.c>
+
+_Thread_local struct __vector_cache_t __vector_cache_local;
+
+const struct vector_allocator_t vector_cache = {
+  .allocate = __vector_cache_allocate,
+  .reallocate = __vector_cache_reallocate,
+  .deallocate = __vector_cache_deallocate,
+  .usable = __vector_cache_usable,
+  .context = NULL,
+};
+
+extern __typeof__(vector_cache_flush) vector_cache_flush;
+extern __typeof__(vector_cache_stats) vector_cache_stats;
+extern __typeof__(__vector_cache_class) __vector_cache_class;
+extern __typeof__(__vector_cache_allocate) __vector_cache_allocate;
+extern __typeof__(__vector_cache_reallocate) __vector_cache_reallocate;
+extern __typeof__(__vector_cache_deallocate) __vector_cache_deallocate;
+extern __typeof__(__vector_cache_usable) __vector_cache_usable;
@@ -4,3 +4,6 @@
 
 extern __typeof__(vector_create) vector_create;
 extern __typeof__(vector_import_z) vector_import_z;
+extern __typeof__(vector_create_using) vector_create_using;
+extern __typeof__(vector_create_inline_z) vector_create_inline_z;
+extern __typeof__(vector_import_using_z) vector_import_using_z;
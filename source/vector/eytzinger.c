@@ -0,0 +1,12 @@
+/// @file source/vector/eytzinger.c
+
+#include <vector/eytzinger.c>
+
+extern __typeof__(vector_eytzinger_z) vector_eytzinger_z;
+extern __typeof__(vector_eytzinger_lower_bound_z)
+  vector_eytzinger_lower_bound_z;
+extern __typeof__(vector_eytzinger_upper_bound_z)
+  vector_eytzinger_upper_bound_z;
+extern __typeof__(vector_eytzinger_search_z) vector_eytzinger_search_z;
+extern __typeof__(__vector_eytzinger_rank) __vector_eytzinger_rank;
+extern __typeof__(__vector_eytzinger_bound_z) __vector_eytzinger_bound_z;
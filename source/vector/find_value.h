@@ -0,0 +1,134 @@
+/// @file source/vector/find_value.h
+
+// The kernels of vector_find_value_next_z() and vector_find_value_last_z() for
+// a kind of block. This is included by source/vector/search.c once for each
+// kind of block that it defines __VECTOR_BLOCK, __vector_block_t and the
+// __vector_block_*() operations for, or without __VECTOR_BLOCK to compare each
+// element with memcmp(). __VECTOR_KERNEL(name) must name each kernel and
+// __VECTOR_KERNEL_TARGET must be the attributes of each kernel.
+
+// Find the first element at or after i in data of length elements
+static inline __VECTOR_KERNEL_TARGET size_t __VECTOR_KERNEL(next_z)(
+    const char *data, size_t i, size_t length, const void *elmt, size_t z) {
+#ifdef __VECTOR_BLOCK
+  // A block is a whole number of elements so each element is compared in a
+  // single block with the element repeated to fill it.
+  char fill[__VECTOR_BLOCK];
+  for (size_t k = 0; k < sizeof(fill); k += z)
+    memcpy(fill + k, elmt, z);
+  __vector_block_t block = __vector_block_load(fill);
+  size_t n = sizeof(fill) / z;
+
+  // compare four blocks at a time and only look for the element in them if
+  // any bytes are equal
+  for (; length - i >= 4 * n; i += 4 * n) {
+    const char *p = data + i * z;
+    __vector_block_t equal[4];
+    for (size_t k = 0; k < 4; k++) {
+      __vector_block_t x = __vector_block_load(p + k * sizeof(fill));
+      equal[k] = __vector_block_equal(x, block, z);
+    }
+    __vector_block_t any = __vector_block_or(
+        __vector_block_or(equal[0], equal[1]),
+        __vector_block_or(equal[2], equal[3]));
+    if (__vector_block_mask(any) == 0)
+      continue;
+
+    for (size_t k = 0; k < 4; k++) {
+      uint32_t mask = __vector_find_mask(__vector_block_mask(equal[k]), z);
+      if (mask != 0)
+        return i + k * n + (size_t) __builtin_ctz(mask) / z;
+    }
+  }
+#endif /* __VECTOR_BLOCK */
+
+  for (; i < length; i++) {
+    if (memcmp(data + i * z, elmt, z) == 0)
+      return i;
+  }
+  return SIZE_MAX;
+}
+
+// Find the last element before i in data
+static inline __VECTOR_KERNEL_TARGET size_t __VECTOR_KERNEL(last_z)(
+    const char *data, size_t i, const void *elmt, size_t z) {
+#ifdef __VECTOR_BLOCK
+  char fill[__VECTOR_BLOCK];
+  for (size_t k = 0; k < sizeof(fill); k += z)
+    memcpy(fill + k, elmt, z);
+  __vector_block_t block = __vector_block_load(fill);
+  size_t n = sizeof(fill) / z;
+
+  for (; i >= 4 * n; i -= 4 * n) {
+    const char *p = data + (i - 4 * n) * z;
+    __vector_block_t equal[4];
+    for (size_t k = 0; k < 4; k++) {
+      __vector_block_t x = __vector_block_load(p + k * sizeof(fill));
+      equal[k] = __vector_block_equal(x, block, z);
+    }
+    __vector_block_t any = __vector_block_or(
+        __vector_block_or(equal[0], equal[1]),
+        __vector_block_or(equal[2], equal[3]));
+    if (__vector_block_mask(any) == 0)
+      continue;
+
+    for (size_t k = 4; k-- > 0; ) {
+      uint32_t mask = __vector_find_mask(__vector_block_mask(equal[k]), z);
+      if (mask != 0)
+        return i - (4 - k) * n + (size_t) (31 - __builtin_clz(mask)) / z;
+    }
+  }
+#endif /* __VECTOR_BLOCK */
+
+  while (i-- > 0) {
+    if (memcmp(data + i * z, elmt, z) == 0)
+      return i;
+  }
+  return SIZE_MAX;
+}
+
+// Call the kernels with a constant z so that each compare is specialized to
+// its size. Elements of any other size are compared with memcmp().
+
+static __VECTOR_KERNEL_TARGET size_t __VECTOR_KERNEL(next)(
+    const char *data, size_t i, size_t length, const void *elmt, size_t z) {
+  switch (z) {
+  case 1: return __VECTOR_KERNEL(next_z)(data, i, length, elmt, 1);
+  case 2: return __VECTOR_KERNEL(next_z)(data, i, length, elmt, 2);
+  case 4: return __VECTOR_KERNEL(next_z)(data, i, length, elmt, 4);
+  case 8: return __VECTOR_KERNEL(next_z)(data, i, length, elmt, 8);
+  case 16: return __VECTOR_KERNEL(next_z)(data, i, length, elmt, 16);
+  }
+
+  for (; i < length; i++) {
+    if (memcmp(data + i * z, elmt, z) == 0)
+      return i;
+  }
+  return SIZE_MAX;
+}
+
+static __VECTOR_KERNEL_TARGET size_t __VECTOR_KERNEL(last)(
+    const char *data, size_t i, const void *elmt, size_t z) {
+  switch (z) {
+  case 1: return __VECTOR_KERNEL(last_z)(data, i, elmt, 1);
+  case 2: return __VECTOR_KERNEL(last_z)(data, i, elmt, 2);
+  case 4: return __VECTOR_KERNEL(last_z)(data, i, elmt, 4);
+  case 8: return __VECTOR_KERNEL(last_z)(data, i, elmt, 8);
+  case 16: return __VECTOR_KERNEL(last_z)(data, i, elmt, 16);
+  }
+
+  while (i-- > 0) {
+    if (memcmp(data + i * z, elmt, z) == 0)
+      return i;
+  }
+  return SIZE_MAX;
+}
+
+#undef __VECTOR_BLOCK
+#undef __vector_block_t
+#undef __vector_block_load
+#undef __vector_block_or
+#undef __vector_block_mask
+#undef __vector_block_equal
+#undef __VECTOR_KERNEL
+#undef __VECTOR_KERNEL_TARGET
@@ -6,3 +6,9 @@ extern __typeof__(vector_insert_z) vector_insert_z;
 extern __typeof__(vector_inject_z) vector_inject_z;
 extern __typeof__(vector_append_z) vector_append_z;
 extern __typeof__(vector_extend_z) vector_extend_z;
+extern __typeof__(vector_extend_many_z) vector_extend_many_z;
+extern __typeof__(vector_concat_z) vector_concat_z;
+extern __typeof__(vector_insert_many_z) vector_insert_many_z;
+extern __typeof__(vector_swap_insert_z) vector_swap_insert_z;
+extern __typeof__(vector_replace_z) vector_replace_z;
+extern __typeof__(vector_splice_z) vector_splice_z;
@@ -0,0 +1,138 @@
+/// @file source/vector/io.c
+
+#include <errno.h>
+#include <limits.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <vector/io.c>
+#include <vector/access.h>
+#include <vector/insert.h>
+#include <vector/resize.h>
+
+/**
+ * @brief Read into the @a iovcnt buffers of @a iov from the @a fd (at the
+ *   @a offset unless it's negative) and return the number of bytes read
+ *
+ * The length of each buffer is a multiple of @a z. If the bytes read end in the
+ * middle of an element then this reads the rest of the element into the buffer
+ * that contains it. On failure this returns the bytes read so far or -1 if
+ * none were read.
+ */
+static ssize_t transfer(
+    int fd, struct iovec *iov, int iovcnt, off_t offset, size_t z) {
+  size_t n = 0;
+
+  for (;;) {
+    ssize_t result;
+
+    if (offset >= 0)
+      result = pread(fd, iov->iov_base, iov->iov_len, offset + (off_t) n);
+    else if (iovcnt == 1)
+      result = read(fd, iov->iov_base, iov->iov_len);
+    else
+      result = readv(fd, iov, iovcnt);
+
+    if (result < 0 && errno == EINTR)
+      continue;
+    if (result < 0)
+      return n > 0 ? (ssize_t) n : -1;
+    if (result == 0 || (n += (size_t) result) % z == 0)
+      return (ssize_t) n;
+
+    // advance past the bytes read and then read just the rest of the element
+    while ((size_t) result >= iov->iov_len)
+      result -= (ssize_t) iov->iov_len, iov++, iovcnt--;
+    iov->iov_base = (char *) iov->iov_base + result;
+    iov->iov_len = z - n % z;
+    iovcnt = 1;
+  }
+}
+
+/// Append the elements of the @a n bytes read into the tail of the @a vector
+static void commit(vector_t vector, ssize_t n, ssize_t *count, size_t z) {
+  if (n < 0) {
+    *count = -1;
+    return;
+  }
+
+  *count = (ssize_t) ((size_t) n / z);
+  __vector_to_header(vector)->length += (size_t) n / z;
+}
+
+/// Ensure the @a vector has room for @a max more elements and read into them
+static vector_t extend(
+    vector_t vector, int fd, off_t offset, size_t max, ssize_t *count,
+    size_t z) {
+  size_t length = vector_length(vector), size;
+
+  if (__builtin_add_overflow(length, max, &length)
+      || __builtin_mul_overflow(max, z, &size))
+    return errno = ENOMEM, NULL;
+
+  if ((vector = vector_ensure_z(vector, length, z)) == NULL)
+    return NULL;
+
+  // a single read can't return more than SSIZE_MAX bytes
+  if (size > SSIZE_MAX)
+    size = SSIZE_MAX / z * z;
+
+  struct iovec iov = {
+    .iov_base = vector_at(vector, vector_length(vector), z),
+    .iov_len = size,
+  };
+  commit(vector, transfer(fd, &iov, 1, offset, z), count, z);
+
+  return vector;
+}
+
+vector_t vector_extend_from_fd_z(
+    vector_t vector, int fd, size_t max, ssize_t *count, size_t z) {
+  return extend(vector, fd, -1, max, count, z);
+}
+
+vector_t vector_extend_from_fd_at_z(
+    vector_t vector, int fd, off_t offset, size_t max, ssize_t *count,
+    size_t z) {
+  return extend(vector, fd, offset, max, count, z);
+}
+
+vector_t vector_extend_from_fdv_z(
+    vector_t vector, int fd, size_t max, ssize_t *count, size_t z) {
+  char buffer[VECTOR_IO_BUFFER];
+  size_t length = vector_length(vector);
+  size_t spare = vector_volume(vector) - length;
+  size_t extra = sizeof(buffer) / z;
+
+  // The buffer can't hold a single element so read straight into the tail.
+  if (extra == 0)
+    return extend(vector, fd, -1, max, count, z);
+
+  if (spare > max)
+    spare = max;
+  if (spare > (SSIZE_MAX - sizeof(buffer)) / z)
+    spare = (SSIZE_MAX - sizeof(buffer)) / z;
+  if (extra > max - spare)
+    extra = max - spare;
+
+  struct iovec iov[2] = {
+    { .iov_base = vector_at(vector, length, z), .iov_len = spare * z },
+    { .iov_base = buffer, .iov_len = extra * z },
+  };
+  ssize_t n = transfer(fd, iov, 2, -1, z);
+
+  // commit the elements read into the volume and then extend by the rest
+  if (n < 0 || (size_t) n / z <= spare) {
+    commit(vector, n, count, z);
+    return vector;
+  }
+
+  // if the extend fails then only the elements in the volume were appended
+  size_t rest = (size_t) n / z - spare;
+  __vector_to_header(vector)->length += spare;
+  *count = (ssize_t) spare;
+  if ((vector = vector_extend_z(vector, buffer, rest, z)) != NULL)
+    *count = (ssize_t) (spare + rest);
+  return vector;
+}
@@ -0,0 +1,91 @@
+/// @file source/vector/mmap.c
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif /* _GNU_SOURCE */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include <vector/mmap.c>
+
+static bool huge = true;
+
+const struct vector_allocator_t vector_mmap = {
+  .allocate = __vector_mmap_allocate,
+  .reallocate = __vector_mmap_reallocate,
+  .deallocate = __vector_mmap_deallocate,
+  .context = NULL,
+  .usable = NULL,
+};
+
+const struct vector_allocator_t vector_mmap_huge = {
+  .allocate = __vector_mmap_allocate,
+  .reallocate = __vector_mmap_reallocate,
+  .deallocate = __vector_mmap_deallocate,
+  .context = &huge,
+  .usable = NULL,
+};
+
+/// Advise the kernel to back the @a size bytes mapped at @a data with huge
+/// pages if the @a context asks for it
+static void advise(void *data, size_t size, void *context) {
+#ifdef MADV_HUGEPAGE
+  // this is only a hint so its failure is ignored
+  if (context != NULL && *(bool *) context)
+    (void) madvise(data, size, MADV_HUGEPAGE);
+#else
+  (void) data, (void) size, (void) context;
+#endif /* MADV_HUGEPAGE */
+}
+
+void *__vector_mmap_allocate(size_t size, void *context) {
+  void *data;
+
+  if (size < VECTOR_MMAP_THRESHOLD)
+    return malloc(size);
+
+  data = mmap(NULL, size, PROT_READ | PROT_WRITE,
+      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (data == MAP_FAILED)
+    return NULL;
+  advise(data, size, context);
+  return data;
+}
+
+void *__vector_mmap_reallocate(
+    void *data, size_t prior, size_t size, void *context) {
+  void *result;
+
+  if (prior < VECTOR_MMAP_THRESHOLD && size < VECTOR_MMAP_THRESHOLD)
+    return realloc(data, size);
+
+#ifdef MREMAP_MAYMOVE
+  if (prior >= VECTOR_MMAP_THRESHOLD && size >= VECTOR_MMAP_THRESHOLD) {
+    if ((result = mremap(data, prior, size, MREMAP_MAYMOVE)) == MAP_FAILED)
+      return NULL;
+    if (size > prior)
+      advise(result, size, context);
+    return result;
+  }
+#endif /* MREMAP_MAYMOVE */
+
+  // the allocation crosses the threshold (or can't be remapped) so copy it
+  if ((result = __vector_mmap_allocate(size, context)) == NULL)
+    return NULL;
+  memcpy(result, data, prior < size ? prior : size);
+  __vector_mmap_deallocate(data, prior, context);
+  return result;
+}
+
+void __vector_mmap_deallocate(void *data, size_t size, void *context) {
+  (void) context;
+
+  if (size < VECTOR_MMAP_THRESHOLD)
+    free(data);
+  else
+    munmap(data, size);
+}
@@ -4,3 +4,5 @@
 
 extern __typeof__(vector_move_z) vector_move_z;
 extern __typeof__(vector_swap_z) vector_swap_z;
+extern __typeof__(vector_rotate_z) vector_rotate_z;
+extern __typeof__(__vector_exchange) __vector_exchange;
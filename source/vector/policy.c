@@ -0,0 +1,33 @@
+/// @file source/vector/policy.c
+
+#include <vector/policy.c>
+
+const struct vector_policy_t vector_policy_default = {
+  .expand = vector_expand_8_5,
+  .contract = vector_contract_half,
+  .expansion = 0,
+  .contraction = 0,
+  .slack = 0,
+};
+
+const struct vector_policy_t vector_policy_class = {
+  .expand = vector_expand_class,
+  .contract = vector_contract_half,
+  .expansion = 0,
+  .contraction = 0,
+  .slack = 1,
+};
+
+extern __typeof__(vector_policy) vector_policy;
+extern __typeof__(vector_set_policy) vector_set_policy;
+extern __typeof__(vector_expand_8_5) vector_expand_8_5;
+extern __typeof__(vector_expand_2) vector_expand_2;
+extern __typeof__(vector_expand_3_2) vector_expand_3_2;
+extern __typeof__(vector_expand_page) vector_expand_page;
+extern __typeof__(vector_expand_class) vector_expand_class;
+extern __typeof__(vector_expand_increment) vector_expand_increment;
+extern __typeof__(vector_contract_half) vector_contract_half;
+extern __typeof__(vector_contract_never) vector_contract_never;
+extern __typeof__(vector_contract_divisor) vector_contract_divisor;
+extern __typeof__(__vector_policy) __vector_policy;
+extern __typeof__(__vector_policy_round) __vector_policy_round;
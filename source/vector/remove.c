@@ -5,3 +5,12 @@
 extern __typeof__(vector_remove_z) vector_remove_z;
 extern __typeof__(vector_excise_z) vector_excise_z;
 extern __typeof__(vector_truncate_z) vector_truncate_z;
+extern __typeof__(vector_remove_if_z) vector_remove_if_z;
+extern __typeof__(vector_remove_if_with_z) vector_remove_if_with_z;
+extern __typeof__(vector_retain_z) vector_retain_z;
+extern __typeof__(vector_retain_with_z) vector_retain_with_z;
+extern __typeof__(__vector_filter_z) __vector_filter_z;
+extern __typeof__(vector_excise_indices_z) vector_excise_indices_z;
+extern __typeof__(vector_excise_bitmap_z) vector_excise_bitmap_z;
+extern __typeof__(__vector_compact_z) __vector_compact_z;
+extern __typeof__(vector_swap_remove_z) vector_swap_remove_z;
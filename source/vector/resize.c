@@ -5,3 +5,6 @@
 extern __typeof__(vector_resize_z) vector_resize_z;
 extern __typeof__(vector_ensure_z) vector_ensure_z;
 extern __typeof__(vector_shrink_z) vector_shrink_z;
+extern __typeof__(vector_pin) vector_pin;
+extern __typeof__(vector_unpin) vector_unpin;
+extern __typeof__(vector_pinned) vector_pinned;
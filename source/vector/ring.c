@@ -0,0 +1,12 @@
+/// @file source/vector/ring.c
+
+#include <vector/ring.c>
+
+extern __typeof__(vector_ring) vector_ring;
+extern __typeof__(vector_unring_z) vector_unring_z;
+extern __typeof__(vector_ringed) vector_ringed;
+extern __typeof__(vector_segments_z) vector_segments_z;
+extern __typeof__(__vector_ring_index) __vector_ring_index;
+extern __typeof__(__vector_ring_linearize_z) __vector_ring_linearize_z;
+extern __typeof__(__vector_ring_push_z) __vector_ring_push_z;
+extern __typeof__(__vector_ring_unshift_z) __vector_ring_unshift_z;
@@ -1,8 +1,115 @@
 /// @file source/vector/search.c
 
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
 #include <vector/search.c>
 
+// Reduce a mask of equal bytes to a mask of the first byte of each equal
+// element of size z, which must be 1, 2, 4, 8 or 16. Bit b is set in the result
+// if b is a multiple of z and bits b through b + z - 1 are set in the mask.
+static inline uint32_t __vector_find_mask(uint32_t mask, size_t z) {
+  // clear each bit unless the z - 1 bits above it are also set
+  for (size_t k = 1; k < z; k <<= 1)
+    mask &= mask >> k;
+
+  // and then keep only the bit of the first byte of each element
+  return mask & (UINT32_MAX / (UINT32_MAX >> (32 - z)));
+}
+
+// A block is __VECTOR_BLOCK bytes loaded with __vector_block_load(). Two blocks
+// of elements of size z are compared with __vector_block_equal(), which sets
+// each byte of an equal element in the result. Where there's no compare of
+// elements of size z the bytes are compared in smaller parts, so
+// __vector_find_mask() must be used to confirm that each byte of an element is
+// equal. __vector_block_mask() returns a mask with bit b set if the high bit of
+// byte b in a block is set.
+
+// Unless the library is built for AVX2 the kernels of __vector_find_value_*()
+// use SSE2 if the library is built for it and memcmp() otherwise.
+#ifndef __AVX2__
+#ifdef __SSE2__
+#define __VECTOR_BLOCK 16
+#define __vector_block_t __m128i
+#define __vector_block_load(p) _mm_loadu_si128((const __m128i *) (p))
+#define __vector_block_or(a, b) _mm_or_si128((a), (b))
+#define __vector_block_mask(a) ((uint32_t) _mm_movemask_epi8((a)))
+#define __vector_block_equal(a, b, z) ( \
+  (z) == 1 ? _mm_cmpeq_epi8((a), (b)) : \
+  (z) == 2 ? _mm_cmpeq_epi16((a), (b)) : _mm_cmpeq_epi32((a), (b)))
+#endif /* __SSE2__ */
+#define __VECTOR_KERNEL(name) __vector_find_value_##name
+#define __VECTOR_KERNEL_TARGET
+#include "find_value.h"
+#endif /* __AVX2__ */
+
+// On x86 the kernels of __vector_find_value_avx2_*() use AVX2 regardless of
+// how the library is built, and vector_find_value_next_z() and
+// vector_find_value_last_z() call them if the processor supports AVX2. If the
+// library is built for AVX2 then these are the only kernels.
+#if defined(__x86_64__) || defined(__i386__)
+#define __VECTOR_BLOCK 32
+#define __vector_block_t __m256i
+#define __vector_block_load(p) _mm256_loadu_si256((const __m256i *) (p))
+#define __vector_block_or(a, b) _mm256_or_si256((a), (b))
+#define __vector_block_mask(a) ((uint32_t) _mm256_movemask_epi8((a)))
+#define __vector_block_equal(a, b, z) ( \
+  (z) == 1 ? _mm256_cmpeq_epi8((a), (b)) : \
+  (z) == 2 ? _mm256_cmpeq_epi16((a), (b)) : \
+  (z) == 4 ? _mm256_cmpeq_epi32((a), (b)) : _mm256_cmpeq_epi64((a), (b)))
+#ifdef __AVX2__
+#define __VECTOR_KERNEL(name) __vector_find_value_##name
+#define __VECTOR_KERNEL_TARGET
+#else
+#define __VECTOR_FIND_VALUE_AVX2
+#define __VECTOR_KERNEL(name) __vector_find_value_avx2_##name
+#define __VECTOR_KERNEL_TARGET __attribute__((target("avx2")))
+#endif /* __AVX2__ */
+#include "find_value.h"
+#endif /* __x86_64__ || __i386__ */
+
+size_t vector_find_value_z(vector_c vector, const void *elmt, size_t z) {
+  return vector_find_value_next_z(vector, 0, elmt, z);
+}
+
+size_t vector_find_value_next_z(
+    vector_c vector, size_t i, const void *elmt, size_t z) {
+  size_t length = vector_length(vector);
+
+#ifdef __VECTOR_FIND_VALUE_AVX2
+  if (__builtin_cpu_supports("avx2"))
+    return __vector_find_value_avx2_next(vector, i, length, elmt, z);
+#endif /* __VECTOR_FIND_VALUE_AVX2 */
+
+  return __vector_find_value_next(vector, i, length, elmt, z);
+}
+
+size_t vector_find_value_last_z(
+    vector_c vector, size_t i, const void *elmt, size_t z) {
+#ifdef __VECTOR_FIND_VALUE_AVX2
+  if (__builtin_cpu_supports("avx2"))
+    return __vector_find_value_avx2_last(vector, i, elmt, z);
+#endif /* __VECTOR_FIND_VALUE_AVX2 */
+
+  return __vector_find_value_last(vector, i, elmt, z);
+}
+
 extern __typeof__(vector_find_z) vector_find_z;
 extern __typeof__(vector_find_next_z) vector_find_next_z;
 extern __typeof__(vector_find_last_z) vector_find_last_z;
 extern __typeof__(vector_search_z) vector_search_z;
+extern __typeof__(vector_lower_bound_z) vector_lower_bound_z;
+extern __typeof__(vector_lower_bound_with_z) vector_lower_bound_with_z;
+extern __typeof__(vector_upper_bound_z) vector_upper_bound_z;
+extern __typeof__(vector_upper_bound_with_z) vector_upper_bound_with_z;
+extern __typeof__(vector_equal_range_z) vector_equal_range_z;
+extern __typeof__(vector_equal_range_with_z) vector_equal_range_with_z;
+extern __typeof__(vector_search_many_z) vector_search_many_z;
+extern __typeof__(__vector_bound_z) __vector_bound_z;
+extern __typeof__(__vector_sorted) __vector_sorted;
+extern __typeof__(__vector_search_merge_z) __vector_search_merge_z;
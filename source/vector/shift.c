@@ -4,3 +4,4 @@
 
 extern __typeof__(vector_pull_z) vector_pull_z;
 extern __typeof__(vector_shift_z) vector_shift_z;
+extern __typeof__(vector_unshift_z) vector_unshift_z;
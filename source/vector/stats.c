@@ -0,0 +1,10 @@
+/// @file source/vector/stats.c
+
+#include <vector/stats.c>
+
+_Thread_local struct vector_stats_t __vector_stats_local;
+
+struct vector_stats_t __vector_stats_global;
+
+extern __typeof__(vector_stats) vector_stats;
+extern __typeof__(vector_stats_global) vector_stats_global;
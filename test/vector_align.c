@@ -0,0 +1,137 @@
+#include <assert.h>
+#include <errno.h>
+#include <stdalign.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "test.h"
+
+static int malloc_errno = 0;
+__attribute__((used)) void *stub_malloc(size_t size) {
+  if (malloc_errno != 0)
+    return errno = malloc_errno, NULL;
+  return malloc(size);
+}
+
+static int realloc_errno = 0;
+__attribute__((used)) void *stub_realloc(void *data, size_t size) {
+  if (realloc_errno != 0)
+    return errno = realloc_errno, NULL;
+  return realloc(data, size);
+}
+
+void test_vector_aligned(void) {
+  // It returns the same allocator for the same alignment
+  assert(vector_aligned(64) != NULL);
+  assert(vector_aligned(64) == vector_aligned(64));
+  assert(vector_aligned(64) != vector_aligned(32));
+
+  // An alignment less than max_align_t is rounded up to it
+  assert(vector_aligned(1) == vector_aligned(alignof(max_align_t)));
+
+  // When the alignment isn't a power of two it returns NULL with errno set
+  // to EINVAL
+  errno = 0;
+  assert(vector_aligned(0) == NULL);
+  assert(errno == EINVAL);
+  errno = 0;
+  assert(vector_aligned(48) == NULL);
+  assert(errno == EINVAL);
+
+  // When the alignment is greater than the limit it returns NULL with errno
+  // set to EINVAL
+  errno = 0;
+  assert(vector_aligned(VECTOR_ALIGNMENT_LIMIT * 2) == NULL);
+  assert(errno == EINVAL);
+  assert(vector_aligned(VECTOR_ALIGNMENT_LIMIT) != NULL);
+}
+
+void test_vector_create_aligned(void) {
+  float *vector;
+
+  // When the alignment is invalid it returns NULL with errno set to EINVAL
+  errno = 0;
+  assert(vector_create_aligned(3) == NULL);
+  assert(errno == EINVAL);
+
+  // When the allocation is unsuccessful it returns NULL with errno retained
+  // from malloc()
+  malloc_errno = ENOENT;
+  errno = 0;
+  assert(vector_create_aligned(64) == NULL);
+  assert(errno == ENOENT);
+  malloc_errno = 0;
+
+  // Its elements are aligned and retain their alignment across each resize
+  for (size_t alignment = 32; alignment <= 4096; alignment *= 2) {
+    vector = vector_create_aligned(alignment);
+    assert((uintptr_t) vector % alignment == 0);
+    assert(vector_allocator(vector) == vector_aligned(alignment));
+
+    for (int i = 0; i < 1000; i++) {
+      float number = (float) i;
+      vector = vector_append(vector, &number);
+      assert((uintptr_t) vector % alignment == 0);
+    }
+    for (int i = 0; i < 1000; i++)
+      assert(vector[i] == (float) i);
+
+    vector = vector_truncate(vector, 3);
+    assert((uintptr_t) vector % alignment == 0);
+    assert_vector_data(vector, 0, 1, 2);
+
+    vector_delete(vector);
+  }
+}
+
+void test_vector_import_aligned(void) {
+  int data[] = { 1, 2, 3, 5, 8, 13 };
+  int *vector;
+
+  // It imports the data into an aligned vector
+  vector = vector_import_aligned(64, data, 6);
+  assert((uintptr_t) vector % 64 == 0);
+  assert_vector_data(vector, 1, 2, 3, 5, 8, 13);
+
+  // When the resize is unsuccessful the vector is unmodified
+  realloc_errno = ENOENT;
+  assert(vector_resize(vector, 1000) == NULL);
+  realloc_errno = 0;
+  assert_vector_data(vector, 1, 2, 3, 5, 8, 13);
+
+  // A duplicate of an aligned vector is aligned
+  int *duplicate = vector_duplicate(vector);
+  assert((uintptr_t) duplicate % 64 == 0);
+  assert(vector_allocator(duplicate) == vector_allocator(vector));
+  assert_vector_data(duplicate, 1, 2, 3, 5, 8, 13);
+  vector_delete(duplicate);
+
+  vector_delete(vector);
+}
+
+void test_vector_duplicate_aligned(void) {
+  int *vector = vector_define(int, 1, 2, 3, 5, 8, 13);
+
+  // It duplicates any vector into an aligned vector
+  int *duplicate = vector_duplicate_aligned(vector, 128);
+  assert((uintptr_t) duplicate % 128 == 0);
+  assert(vector_allocator(duplicate) == vector_aligned(128));
+  assert_vector_data(duplicate, 1, 2, 3, 5, 8, 13);
+  vector_delete(duplicate);
+
+  // When the alignment is invalid it returns NULL with errno set to EINVAL
+  errno = 0;
+  assert(vector_duplicate_aligned(vector, 100) == NULL);
+  assert(errno == EINVAL);
+
+  vector_delete(vector);
+}
+
+int main() {
+  test_vector_aligned();
+  test_vector_create_aligned();
+  test_vector_import_aligned();
+  test_vector_duplicate_aligned();
+}
@@ -0,0 +1,119 @@
+#include <assert.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "test.h"
+
+struct record {
+  size_t allocate;
+  size_t reallocate;
+  size_t deallocate;
+  size_t last_prior;
+  size_t last_size;
+  int error;
+};
+
+static void *record_allocate(size_t size, void *context) {
+  struct record *record = context;
+  if (record->error != 0)
+    return errno = record->error, NULL;
+  record->allocate++;
+  record->last_size = size;
+  return malloc(size);
+}
+
+static void *record_reallocate(
+    void *data, size_t prior, size_t size, void *context) {
+  struct record *record = context;
+  if (record->error != 0)
+    return errno = record->error, NULL;
+  record->reallocate++;
+  record->last_prior = prior;
+  record->last_size = size;
+  return realloc(data, size);
+}
+
+static void record_deallocate(void *data, size_t size, void *context) {
+  struct record *record = context;
+  record->deallocate++;
+  record->last_size = size;
+  free(data);
+}
+
+void test_vector_allocator(void) {
+  struct record record = { 0 };
+  struct vector_allocator_t allocator = {
+    record_allocate, record_reallocate, record_deallocate, &record, NULL,
+  };
+  size_t header = sizeof(struct __vector_header_t);
+  int data[] = { 1, 2, 3, 5, 8, 13 };
+  int *vector;
+
+  // A vector that isn't bound to an allocator has a NULL allocator
+  vector = vector_create();
+  assert(vector_allocator(vector) == NULL);
+  vector_delete(vector);
+
+  // When the allocation is unsuccessful it returns NULL with errno retained
+  // from the allocator
+  record.error = ENOENT;
+  errno = 0;
+  assert(vector_create_using(&allocator) == NULL);
+  assert(errno == ENOENT);
+  assert(vector_import_using(&allocator, data, 6) == NULL);
+  assert(errno == ENOENT);
+  record.error = 0;
+
+  // It allocates the vector through the allocator and binds it to the vector
+  vector = vector_create_using(&allocator);
+  assert(record.allocate == 1);
+  assert(record.last_size == header);
+  assert(vector_allocator(vector) == &allocator);
+  assert(vector_length(vector) == 0);
+  assert(vector_volume(vector) == 0);
+
+  // It resizes the vector through the allocator with the prior size
+  vector = vector_resize(vector, 10);
+  assert(record.reallocate == 1);
+  assert(record.last_prior == header);
+  assert(record.last_size == header + 10 * sizeof(int));
+
+  vector = vector_extend(vector, data, 6);
+  assert_vector_data(vector, 1, 2, 3, 5, 8, 13);
+
+  // When the reallocation is unsuccessful it returns NULL with errno retained
+  // from the allocator
+  record.error = ENOENT;
+  errno = 0;
+  assert(vector_resize(vector, 20) == NULL);
+  assert(errno == ENOENT);
+  record.error = 0;
+
+  // It deallocates the vector through the allocator with its size
+  assert(vector_delete(vector) == NULL);
+  assert(record.deallocate == 1);
+  assert(record.last_size == header + 10 * sizeof(int));
+
+  // It imports the data into a vector allocated through the allocator
+  vector = vector_import_using(&allocator, data, 6);
+  assert(record.allocate == 2);
+  assert(record.last_size == header + 6 * sizeof(int));
+  assert(vector_allocator(vector) == &allocator);
+  assert_vector_data(vector, 1, 2, 3, 5, 8, 13);
+
+  // A duplicate is bound to the same allocator as its source
+  int *result = vector_duplicate(vector);
+  assert(record.allocate == 3);
+  assert(vector_allocator(result) == &allocator);
+  assert_vector_data(result, 1, 2, 3, 5, 8, 13);
+
+  vector_delete(result);
+  vector_delete(vector);
+  assert(record.deallocate == 3);
+}
+
+int main() {
+  test_vector_allocator();
+}
@@ -0,0 +1,101 @@
+#include <assert.h>
+#include <errno.h>
+#include <stdalign.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "test.h"
+
+static int malloc_errno = 0;
+static size_t malloc_count = 0;
+__attribute__((used)) void *stub_malloc(size_t size) {
+  if (malloc_errno != 0)
+    return errno = malloc_errno, NULL;
+  malloc_count++;
+  return malloc(size);
+}
+
+static size_t free_count = 0;
+__attribute__((used)) void stub_free(void *data) {
+  free_count++;
+  free(data);
+}
+
+void test_vector_arena(void) {
+  struct vector_arena_t *arena;
+  int data[] = { 1, 2, 3, 5, 8, 13 };
+
+  // When the allocation is unsuccessful it returns NULL with errno retained
+  // from malloc()
+  malloc_errno = ENOENT;
+  errno = 0;
+  assert(vector_arena_create(4096) == NULL);
+  assert(errno == ENOENT);
+  malloc_errno = 0;
+
+  // It doesn't allocate a chunk until a vector is created in it
+  malloc_count = 0;
+  arena = vector_arena_create(4096);
+  assert(malloc_count == 1);
+
+  // It binds each vector created in it to its allocator
+  int *va = vector_create_in(arena);
+  assert(va != NULL);
+  assert(malloc_count == 2);
+  assert(vector_allocator(va) == &arena->allocator);
+  assert(vector_length(va) == 0);
+
+  // Each vector in it is aligned to a max_align_t
+  assert((uintptr_t) va % alignof(max_align_t) == 0);
+
+  // When the vector is the most recent allocation it's extended in place
+  int *vb = vector_import_in(arena, data, 6);
+  assert(malloc_count == 2);
+  assert(vector_allocator(vb) == &arena->allocator);
+  assert((uintptr_t) vb % alignof(max_align_t) == 0);
+
+  int *prior = vb;
+  vb = vector_extend(vb, data, 6);
+  assert(vb == prior);
+  assert_vector_data(vb, 1, 2, 3, 5, 8, 13, 1, 2, 3, 5, 8, 13);
+
+  // When the vector isn't the most recent allocation it's copied
+  prior = va;
+  va = vector_extend(va, data, 6);
+  assert(va != prior);
+  assert_vector_data(va, 1, 2, 3, 5, 8, 13);
+  assert_vector_data(vb, 1, 2, 3, 5, 8, 13, 1, 2, 3, 5, 8, 13);
+
+  // When the vector is the most recent allocation its deletion is reclaimed
+  int *vc = vector_create_in(arena);
+  vector_delete(vc);
+  assert(vector_create_in(arena) == vc);
+
+  // When the vector doesn't fit in the current chunk a new chunk is allocated
+  va = vector_ensure(va, 2048);
+  assert(malloc_count == 3);
+  assert_vector_data(va, 1, 2, 3, 5, 8, 13);
+
+  // It retains the current chunk on reset
+  free_count = 0;
+  vector_arena_reset(arena);
+  assert(free_count == 1);
+
+  va = vector_import_in(arena, data, 6);
+  assert(malloc_count == 3);
+  assert_vector_data(va, 1, 2, 3, 5, 8, 13);
+
+  // It deallocates each chunk and itself on delete
+  va = vector_ensure(va, 4096);
+  assert(malloc_count == 4);
+
+  free_count = 0;
+  assert(vector_arena_delete(arena) == NULL);
+  assert(free_count == 3);
+}
+
+int main() {
+  test_vector_arena();
+}
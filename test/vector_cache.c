@@ -0,0 +1,146 @@
+#include <assert.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#if defined(__linux__)
+#include <malloc.h>
+#endif
+
+#include <vector.h>
+#include "test.h"
+
+static int malloc_errno = 0;
+static size_t malloc_count = 0;
+__attribute__((used)) void *stub_malloc(size_t size) {
+  if (malloc_errno != 0)
+    return errno = malloc_errno, NULL;
+  malloc_count++;
+  return malloc(size);
+}
+
+static size_t free_count = 0;
+__attribute__((used)) void stub_free(void *data) {
+  free_count++;
+  free(data);
+}
+
+void test_vector_cache_class(void) {
+  // Each size up to the minimum is in the first size class
+  assert(__vector_cache_class(0) == 0);
+  assert(__vector_cache_class(VECTOR_CACHE_MINIMUM) == 0);
+
+  // Each size class is twice the size of the one before it
+  assert(__vector_cache_class(VECTOR_CACHE_MINIMUM + 1) == 1);
+  assert(__vector_cache_class(VECTOR_CACHE_MINIMUM * 2) == 1);
+  assert(__vector_cache_class(VECTOR_CACHE_MINIMUM * 2 + 1) == 2);
+
+  // A size larger than the largest size class isn't in a size class
+  size_t size = (size_t) VECTOR_CACHE_MINIMUM << (VECTOR_CACHE_CLASS_COUNT - 1);
+  assert(__vector_cache_class(size) == VECTOR_CACHE_CLASS_COUNT - 1);
+  assert(__vector_cache_class(size + 1) == VECTOR_CACHE_CLASS_COUNT);
+}
+
+void test_vector_cache(void) {
+  struct vector_cache_stats_t stats;
+  int data[] = { 1, 2, 3, 5, 8, 13 };
+  int *vector;
+
+  // When the allocation is unsuccessful it returns NULL with errno retained
+  // from malloc()
+  malloc_errno = ENOENT;
+  errno = 0;
+  assert(vector_create_using(&vector_cache) == NULL);
+  assert(errno == ENOENT);
+  malloc_errno = 0;
+
+  // The first allocation in a size class is a miss
+  malloc_count = 0;
+  vector = vector_create_using(&vector_cache);
+  assert(malloc_count == 1);
+  stats = vector_cache_stats();
+  assert(stats.hit == 0);
+  assert(stats.miss == 2);
+
+  // A resize within the size class is done in place
+  int *prior = vector;
+  vector = vector_extend(vector, data, 2);
+  assert(vector == prior);
+  assert(malloc_count == 1);
+  assert(vector_cache_stats().hit == 1);
+  assert_vector_data(vector, 1, 2);
+
+  // A resize out of the size class retains the prior allocation
+  vector = vector_ensure(vector, 64);
+  assert(malloc_count == 2);
+  assert(vector_cache_stats().retain == 1);
+  assert_vector_data(vector, 1, 2);
+
+  // A deletion in a size class is retained and reused by the next allocation
+  // in that size class
+  free_count = 0;
+  vector_delete(vector);
+  assert(free_count == 0);
+  assert(vector_cache_stats().retain == 2);
+
+  vector = vector_import_using(&vector_cache, data, 2);
+  assert(malloc_count == 2);
+  assert(vector_cache_stats().hit == 2);
+  assert_vector_data(vector, 1, 2);
+  vector_delete(vector);
+
+  // An allocation larger than each size class is passed to malloc() and free()
+  vector = vector_create_using(&vector_cache);
+  vector = vector_ensure(vector, 4096);
+  stats = vector_cache_stats();
+  vector_delete(vector);
+  assert(vector_cache_stats().release == stats.release + 1);
+
+  // Each size class retains at most VECTOR_CACHE_CLASS_LIMIT allocations
+  int *list[VECTOR_CACHE_CLASS_LIMIT + 1];
+  for (size_t i = 0; i < VECTOR_CACHE_CLASS_LIMIT + 1; i++)
+    list[i] = vector_create_using(&vector_cache);
+  free_count = 0;
+  for (size_t i = 0; i < VECTOR_CACHE_CLASS_LIMIT + 1; i++)
+    vector_delete(list[i]);
+  assert(free_count == 1);
+
+  // It deallocates each retained allocation on a flush
+  free_count = 0;
+  vector_cache_flush();
+  assert(free_count == VECTOR_CACHE_CLASS_LIMIT + 1);
+
+  malloc_count = 0;
+  vector_delete(vector_create_using(&vector_cache));
+  assert(malloc_count == 1);
+
+  // A resize from larger than each size class into a size class shrinks the
+  // allocation to that size class, so the allocation it retains on deletion
+  // isn't any larger than the next allocation in that size class needs
+  vector = vector_create_using(&vector_cache);
+  vector = vector_ensure(vector, 1 << 24);
+  stats = vector_cache_stats();
+  vector = vector_resize(vector, 6);
+  assert(vector != NULL);
+  assert(vector_cache_stats().miss == stats.miss + 1);
+  assert(vector_cache_stats().hit == stats.hit);
+  vector_delete(vector);
+
+  vector = vector_import_using(&vector_cache, data, 6);
+  assert(vector_cache_stats().hit == stats.hit + 1);
+  assert_vector_data(vector, 1, 2, 3, 5, 8, 13);
+#if defined(__linux__)
+  struct __vector_header_t *header = __vector_to_header((vector_t) vector);
+  size_t c = __vector_cache_class(header->size);
+  size_t usable = malloc_usable_size(header);
+  assert(usable < (size_t) VECTOR_CACHE_MINIMUM << (c + 1));
+#endif
+  vector_delete(vector);
+
+  vector_cache_flush();
+}
+
+int main() {
+  test_vector_cache_class();
+  test_vector_cache();
+}
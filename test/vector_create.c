@@ -86,7 +86,55 @@ void test_vector_import(void) {
   vector_delete(vector);
 }
 
+void test_vector_create_inline(void) {
+  vector_storage(int, 4) storage;
+  void *data = (char *) &storage + sizeof(struct __vector_header_t);
+  int *vector;
+
+  // It creates a zero length vector in the storage without an allocation with
+  // volume as the number of elements that fit in the storage
+  malloc_errno = ENOENT;
+  vector = vector_create_inline_z(&storage, sizeof(storage), sizeof(int));
+  assert((void *) vector == data);
+  assert(vector_length(vector) == 0);
+  assert(vector_volume(vector) == 4);
+
+  // While its volume is sufficient the vector remains in the storage
+  vector = vector_extend(vector, ((int[]) { 1, 2, 3, 5 }), 4);
+  assert((void *) vector == data);
+  assert_vector_data(vector, 1, 2, 3, 5);
+
+  // A resize to a lower volume retains the storage and its volume
+  vector = vector_truncate(vector, 1);
+  vector = vector_shrink(vector);
+  assert((void *) vector == data);
+  assert(vector_volume(vector) == 4);
+  assert_vector_data(vector, 1);
+
+  // When the allocation is unsuccessful the vector remains in the storage with
+  // errno retained from malloc()
+  errno = 0;
+  assert(vector_ensure(vector, 5) == NULL);
+  assert(errno == ENOENT);
+  malloc_errno = 0;
+
+  // When its volume is insufficient it's moved into a new allocation
+  vector = vector_extend(vector, ((int[]) { 2, 3, 5, 8 }), 4);
+  assert((void *) vector != data);
+  assert(vector_volume(vector) >= 5);
+  assert_vector_data(vector, 1, 2, 3, 5, 8);
+
+  vector_delete(vector);
+
+  // It creates a vector of the type in storage in the enclosing block
+  int *result = vector_inline(int, 8);
+  assert(vector_length(result) == 0);
+  assert(vector_volume(result) >= 8);
+  vector_delete(result);
+}
+
 int main() {
   test_vector_create();
+  test_vector_create_inline();
   test_vector_import();
 }
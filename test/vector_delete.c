@@ -17,6 +17,13 @@ int main() {
   vector_delete(vector);
   assert(free_object != NULL);
 
+  // It doesn't deallocate storage provided to vector_create_inline_z()
+  free_object = NULL;
+  vector_storage(int, 4) storage;
+  vector = vector_create_inline_z(&storage, sizeof(storage), sizeof(int));
+  vector_delete(vector);
+  assert(free_object == NULL);
+
   // It returns NULL
   assert(vector_delete(vector_create()) == NULL);
 
@@ -0,0 +1,140 @@
+#include <assert.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "test.h"
+
+static int cmpintp(const void *a, const void *b) {
+  int ra = *(const int *) a;
+  int rb = *(const int *) b;
+  return ra < rb ? -1 : (ra > rb ? 1 : 0);
+}
+
+struct entry {
+  const char *name;
+  int key;
+};
+
+static int cmpkey_entry(const void *a, const void *b) {
+  int key = *(const int *) a;
+  const struct entry *entry = b;
+  return key < entry->key ? -1 : (key > entry->key ? 1 : 0);
+}
+
+// vector_eytzinger(), vector_eytzinger_z()
+
+void test_vector_eytzinger(void) {
+  int *vector = vector_define(int, 1, 2, 3, 5, 8, 13, 21, 34, 55, 89);
+  int number = 0;
+
+  // It evaluates each argument once
+  int *layout = vector_eytzinger((number++, vector));
+  assert(number == 1);
+
+  // It stores the elements as a complete binary search tree in breadth first
+  // order
+  assert_vector_data(layout, 21, 5, 55, 2, 13, 34, 89, 1, 3, 8);
+
+  // The vector is unmodified
+  assert_vector_data(vector, 1, 2, 3, 5, 8, 13, 21, 34, 55, 89);
+
+  vector_delete(layout);
+  vector_delete(vector);
+
+  // With an empty vector it returns an empty layout
+  vector = vector_create();
+  layout = vector_eytzinger(vector);
+  assert(layout != NULL);
+  assert(vector_length(layout) == 0);
+
+  vector_delete(layout);
+  vector_delete(vector);
+}
+
+// vector_eytzinger_lower_bound(), vector_eytzinger_upper_bound(),
+// vector_eytzinger_search() and their explicit analogues
+
+void test_vector_eytzinger_bound(void) {
+  int *vector = vector_define(int, 1, 3, 3, 3, 5, 5, 8);
+  int *layout = vector_eytzinger(vector);
+  int elmt = 3;
+  int number = 0;
+  size_t result;
+
+  // It evaluates each argument once
+  result = vector_eytzinger_lower_bound((number++, layout), &elmt, cmpintp);
+  assert(number == 1);
+  result = vector_eytzinger_upper_bound(layout, (number++, &elmt), cmpintp);
+  assert(number == 2);
+  result = vector_eytzinger_search(layout, &elmt, (number++, cmpintp));
+  assert(number == 3);
+
+  // It returns indices in the sorted vector
+  result = vector_eytzinger_lower_bound(layout, &elmt, cmpintp);
+  assert(result == 1);
+  result = vector_eytzinger_upper_bound(layout, &elmt, cmpintp);
+  assert(result == 4);
+  result = vector_eytzinger_search(layout, &elmt, cmpintp);
+  assert(result == 1);
+
+  // When the element isn't in the vector it returns the index to insert it at
+  // or SIZE_MAX from vector_eytzinger_search()
+  elmt = 9;
+  assert(vector_eytzinger_lower_bound(layout, &elmt, cmpintp) == 7);
+  assert(vector_eytzinger_upper_bound(layout, &elmt, cmpintp) == 7);
+  assert(vector_eytzinger_search(layout, &elmt, cmpintp) == SIZE_MAX);
+  elmt = 0;
+  assert(vector_eytzinger_lower_bound(layout, &elmt, cmpintp) == 0);
+  assert(vector_eytzinger_search(layout, &elmt, cmpintp) == SIZE_MAX);
+
+  vector_delete(layout);
+
+  // It agrees with vector_lower_bound() and vector_upper_bound() at each
+  // length and element
+  vector = vector_truncate(vector, 0);
+  for (int length = 0; length < 70; length++) {
+    layout = vector_eytzinger(vector);
+    assert(layout != NULL);
+    for (int e = -1; e <= length / 2 + 1; e++) {
+      size_t lower = vector_lower_bound(vector, &e, cmpintp);
+      size_t upper = vector_upper_bound(vector, &e, cmpintp);
+      assert(vector_eytzinger_lower_bound(layout, &e, cmpintp) == lower);
+      assert(vector_eytzinger_upper_bound(layout, &e, cmpintp) == upper);
+      result = vector_eytzinger_search(layout, &e, cmpintp);
+      assert(result == (lower < upper ? lower : SIZE_MAX));
+    }
+    vector_delete(layout);
+
+    int value = length / 2;
+    int *appended = vector_append(vector, &value);
+    assert(appended != NULL);
+    vector = appended;
+  }
+
+  vector_delete(vector);
+
+  // It passes the element to search for to the function first as
+  // vector_search() does, so it returns the same index with a key comparator
+  struct entry *entries = vector_define(struct entry,
+      { "one", 1 }, { "three", 3 }, { "three", 3 }, { "five", 5 });
+  struct entry *tree = vector_eytzinger(entries);
+  assert(tree != NULL);
+  for (int e = 0; e <= 6; e++) {
+    size_t lower = vector_lower_bound(entries, &e, cmpkey_entry);
+    size_t upper = vector_upper_bound(entries, &e, cmpkey_entry);
+    assert(vector_eytzinger_lower_bound(tree, &e, cmpkey_entry) == lower);
+    assert(vector_eytzinger_upper_bound(tree, &e, cmpkey_entry) == upper);
+    result = vector_eytzinger_search(tree, &e, cmpkey_entry);
+    assert(result == vector_search(entries, &e, cmpkey_entry));
+  }
+  vector_delete(tree);
+  vector_delete(entries);
+}
+
+int main() {
+  test_vector_eytzinger();
+  test_vector_eytzinger_bound();
+}
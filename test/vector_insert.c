@@ -7,8 +7,22 @@
 #include <vector.h>
 #include "test.h"
 
+static size_t malloc_count = 0;
+__attribute__((used)) void *stub_malloc(size_t size) {
+  malloc_count++;
+  return malloc(size);
+}
+
+static size_t realloc_count = 0;
+__attribute__((used)) void *stub_realloc(void *data, size_t size) {
+  realloc_count++;
+  return realloc(data, size);
+}
+
 static int ensure_errno = 0;
+static size_t ensure_count = 0;
 vector_t vector_ensure_z(vector_t vector, size_t length, size_t z) {
+  ensure_count++;
   if (ensure_errno != 0)
     return errno = ensure_errno, NULL;
   return REAL(vector_ensure_z)(vector, length, z);
@@ -215,9 +229,312 @@ void test_vector_extend(void) {
   vector_delete(result);
 }
 
+// vector_extend_many(), vector_extend_many_z()
+
+void test_vector_extend_many(void) {
+  int *vector = vector_define(int, 1, 2);
+  int *a = vector_define(int, 3, 5, 8);
+  int *b = vector_create();
+  int *c = vector_define(int, 13, 21);
+  int *srcs[] = { a, b, c };
+  int number = 0;
+
+  // It evaluates each argument once
+  vector = vector_extend_many((number++, vector), srcs, 0);
+  assert(number == 1);
+  vector = vector_extend_many(vector, (number++, srcs), 0);
+  assert(number == 2);
+  vector = vector_extend_many(vector, srcs, (number++, 0));
+  assert(number == 3);
+
+  // It appends the elements of each vector in order with a single ensure
+  ensure_count = 0;
+  vector = vector_extend_many(vector, srcs, 3);
+  assert(ensure_count == 1);
+  assert_vector_data(vector, 1, 2, 3, 5, 8, 13, 21);
+
+  // The source vectors are unmodified
+  assert_vector_data(a, 3, 5, 8);
+  assert(vector_length(b) == 0);
+  assert_vector_data(c, 13, 21);
+
+  // When the ensure is unsuccessful it returns NULL with errno retained from
+  // the ensure and the vector unmodified
+  vector = vector_shrink(vector);
+  ensure_errno = ENOENT;
+  errno = 0;
+  assert(vector_extend_many(vector, srcs, 3) == NULL);
+  assert(errno == ENOENT);
+  assert(vector_length(vector) == 7);
+  ensure_errno = 0;
+
+  vector_delete(vector);
+  vector_delete(a);
+  vector_delete(b);
+  vector_delete(c);
+}
+
+// vector_concat(), vector_concat_z()
+
+void test_vector_concat(void) {
+  int *a = vector_define(int, 1, 2, 3);
+  int *b = vector_create();
+  int *c = vector_define(int, 5, 8);
+  int *vectors[] = { a, b, c };
+  int number = 0;
+
+  // It evaluates each argument once
+  int *vector = vector_concat((number++, vectors), 0);
+  assert(number == 1);
+  vector_delete(vector);
+  vector = vector_concat(vectors, (number++, 0));
+  assert(number == 2);
+
+  // With no vectors it returns an empty vector
+  assert(vector != NULL);
+  assert(vector_length(vector) == 0);
+  vector_delete(vector);
+
+  // It allocates a vector of exactly the elements of each vector in order
+  // with a single allocation
+  malloc_count = realloc_count = 0;
+  vector = vector_concat(vectors, 3);
+  assert(malloc_count == 1);
+  assert(realloc_count == 0);
+  assert_vector_data(vector, 1, 2, 3, 5, 8);
+  assert(vector_volume(vector) == 5);
+  vector_delete(vector);
+
+  vector_delete(a);
+  vector_delete(b);
+  vector_delete(c);
+}
+
+// vector_swap_insert(), vector_swap_insert_z()
+
+void test_vector_swap_insert(void) {
+  int *vector = vector_define(int, 1, 2, 3);
+  int number = 0;
+  int elmt = 10;
+
+  // It evaluates each argument once
+  vector = vector_swap_insert((number++, vector), 3, &elmt);
+  assert(number == 1);
+  vector = vector_swap_insert(vector, (number++, 4), &elmt);
+  assert(number == 2);
+  vector = vector_swap_insert(vector, 5, (number++, &elmt));
+  assert(number == 3);
+
+  // At the length it appends the element
+  assert_vector_data(vector, 1, 2, 3, 10, 10, 10);
+
+  // It moves the element at the index to the tail and inserts the element in
+  // its place
+  elmt = 20;
+  vector = vector_swap_insert(vector, 0, &elmt);
+  assert_vector_data(vector, 20, 2, 3, 10, 10, 10, 1);
+  elmt = 30;
+  vector = vector_swap_insert(vector, 2, &elmt);
+  assert_vector_data(vector, 20, 2, 30, 10, 10, 10, 1, 3);
+
+  // When elmt is NULL the inserted element is uninitialized
+  vector = vector_swap_insert(vector, 1, NULL);
+  assert(vector_length(vector) == 9);
+  assert(vector[8] == 2);
+
+  // When the ensure is unsuccessful it returns NULL with errno retained from
+  // the ensure and the vector unmodified
+  vector = vector_shrink(vector);
+  ensure_errno = ENOENT;
+  errno = 0;
+  assert(vector_swap_insert(vector, 0, &elmt) == NULL);
+  assert(errno == ENOENT);
+  assert(vector_length(vector) == 9);
+  assert(vector[0] == 20);
+  ensure_errno = 0;
+
+  vector_delete(vector);
+}
+
+// vector_replace(), vector_replace_z()
+
+static size_t last_replace_z;
+vector_t vector_replace_z(
+    vector_t vector, size_t i, size_t n, const void *elmt, size_t m, size_t z) {
+  return REAL(vector_replace_z)(vector, i, n, elmt, m, last_replace_z = z);
+}
+
+void test_vector_replace(void) {
+  int *vector = vector_define(int, 1, 2, 3, 5, 8, 13);
+  int data[] = { 20, 21, 22, 23 };
+  int number = 0;
+
+  // It evaluates each argument once
+  vector = vector_replace((number++, vector), 0, 0, data, 0);
+  assert(number == 1);
+  vector = vector_replace(vector, (number++, 0), 0, data, 0);
+  assert(number == 2);
+  vector = vector_replace(vector, 0, (number++, 0), data, 0);
+  assert(number == 3);
+  vector = vector_replace(vector, 0, 0, (number++, data), 0);
+  assert(number == 4);
+  vector = vector_replace(vector, 0, 0, data, (number++, 0));
+  assert(number == 5);
+
+  // It calls vector_replace_z() with the element size of the vector
+  assert(last_replace_z == sizeof(vector[0]));
+
+  // With as many elements it overwrites the range in place
+  vector = vector_replace(vector, 1, 2, data, 2);
+  assert_vector_data(vector, 1, 20, 21, 5, 8, 13);
+
+  // With more elements it shifts the tail toward the tail
+  vector = vector_replace(vector, 1, 2, data, 4);
+  assert_vector_data(vector, 1, 20, 21, 22, 23, 5, 8, 13);
+
+  // With fewer elements it shifts the tail toward the head
+  vector = vector_replace(vector, 1, 4, data + 3, 1);
+  assert_vector_data(vector, 1, 23, 5, 8, 13);
+
+  // With no elements it removes the range
+  vector = vector_replace(vector, 0, 2, data, 0);
+  assert_vector_data(vector, 5, 8, 13);
+
+  // It replaces the empty range at the tail
+  vector = vector_replace(vector, 3, 0, data, 2);
+  assert_vector_data(vector, 5, 8, 13, 20, 21);
+
+  // When elmt is NULL the replacement elements are uninitialized
+  vector = vector_replace(vector, 1, 1, NULL, 3);
+  assert(vector_length(vector) == 7);
+  assert(vector[0] == 5);
+  assert(vector[4] == 13);
+  assert(vector[6] == 21);
+
+  // When the resultant length would overflow it returns NULL with errno set
+  // to ENOMEM and the vector unmodified
+  errno = 0;
+  assert(vector_replace(vector, 0, 1, data, SIZE_MAX) == NULL);
+  assert(errno == ENOMEM);
+  assert(vector_length(vector) == 7);
+
+  // When the ensure is unsuccessful it returns NULL with errno retained from
+  // the ensure and the vector unmodified
+  vector = vector_shrink(vector);
+  ensure_errno = ENOENT;
+  errno = 0;
+  assert(vector_replace(vector, 0, 1, data, 2) == NULL);
+  assert(errno == ENOENT);
+  assert(vector_length(vector) == 7);
+  assert(vector[0] == 5);
+  ensure_errno = 0;
+
+  vector_delete(vector);
+}
+
+// vector_splice(), vector_splice_z()
+
+void test_vector_splice(void) {
+  int *dst = vector_define(int, 1, 2, 3);
+  int *src = vector_define(int, 5, 8, 13, 21, 34);
+  int number = 0;
+
+  // It evaluates each argument once
+  dst = vector_splice((number++, dst), 0, &src, 0, 0);
+  assert(number == 1);
+  dst = vector_splice(dst, (number++, 0), &src, 0, 0);
+  assert(number == 2);
+  dst = vector_splice(dst, 0, (number++, &src), 0, 0);
+  assert(number == 3);
+  dst = vector_splice(dst, 0, &src, (number++, 0), 0);
+  assert(number == 4);
+  dst = vector_splice(dst, 0, &src, 0, (number++, 0));
+  assert(number == 5);
+
+  // It moves the range out of the source and into the destination
+  dst = vector_splice(dst, 1, &src, 1, 2);
+  assert_vector_data(dst, 1, 8, 13, 2, 3);
+  assert_vector_data(src, 5, 21, 34);
+
+  // It moves the range to the tail of the destination
+  dst = vector_splice(dst, 5, &src, 0, 3);
+  assert_vector_data(dst, 1, 8, 13, 2, 3, 5, 21, 34);
+
+  // It applies the shrink policy to the source
+  assert(vector_length(src) == 0);
+  assert(vector_volume(src) == 0);
+
+  // When the ensure is unsuccessful it returns NULL with errno retained from
+  // the ensure and neither vector modified
+  src = vector_append(src, &number);
+  dst = vector_shrink(dst);
+  ensure_errno = ENOENT;
+  errno = 0;
+  assert(vector_splice(dst, 0, &src, 0, 1) == NULL);
+  assert(errno == ENOENT);
+  assert(vector_length(dst) == 8);
+  assert(vector_length(src) == 1);
+  ensure_errno = 0;
+
+  vector_delete(dst);
+  vector_delete(src);
+}
+
+// vector_insert_many(), vector_insert_many_z()
+
+void test_vector_insert_many(void) {
+  int *vector = vector_define(int, 1, 2, 3, 5, 8);
+  int number = 0;
+
+  // It evaluates each argument once
+  vector = vector_insert_many((number++, vector), NULL, NULL, 0);
+  assert(number == 1);
+
+  // It inserts each element before the element at its index in the vector
+  // before any insertion
+  size_t index[] = { 0, 2, 2, 4, 5 };
+  int data[] = { 10, 20, 21, 40, 50 };
+  vector = vector_insert_many(vector, index, data, 5);
+  assert_vector_data(vector, 10, 1, 2, 20, 21, 3, 5, 40, 8, 50);
+
+  // With no elements it returns the vector unmodified
+  vector = vector_insert_many(vector, index, data, 0);
+  assert_vector_data(vector, 10, 1, 2, 20, 21, 3, 5, 40, 8, 50);
+
+  // When elmt is NULL the inserted elements are uninitialized
+  size_t tail[] = { 10, 10 };
+  vector = vector_insert_many(vector, tail, NULL, 2);
+  assert(vector_length(vector) == 12);
+  assert(vector[9] == 50);
+
+  // When the resultant length would overflow it returns NULL with errno set
+  // to ENOMEM and the vector unmodified
+  errno = 0;
+  assert(vector_insert_many(vector, index, data, SIZE_MAX) == NULL);
+  assert(errno == ENOMEM);
+  assert(vector_length(vector) == 12);
+
+  // When the ensure is unsuccessful it returns NULL with errno retained from
+  // the ensure and the vector unmodified
+  ensure_errno = ENOENT;
+  errno = 0;
+  assert(vector_insert_many(vector, index, data, 5) == NULL);
+  assert(errno == ENOENT);
+  assert(vector_length(vector) == 12);
+  ensure_errno = 0;
+
+  vector_delete(vector);
+}
+
 int main() {
   test_vector_insert();
   test_vector_inject();
   test_vector_append();
   test_vector_extend();
+  test_vector_extend_many();
+  test_vector_concat();
+  test_vector_swap_insert();
+  test_vector_replace();
+  test_vector_splice();
+  test_vector_insert_many();
 }
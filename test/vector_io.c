@@ -0,0 +1,165 @@
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <vector.h>
+#include "test.h"
+
+static bool realloc_fails = false;
+__attribute__((used)) void *stub_realloc(void *data, size_t size) {
+  if (realloc_fails)
+    return errno = ENOMEM, NULL;
+  return realloc(data, size);
+}
+
+// Return a file descriptor of a temporary file that contains the data
+static int temporary(const void *data, size_t size) {
+  FILE *file = tmpfile();
+  assert(file != NULL);
+  int fd = dup(fileno(file));
+  fclose(file);
+  assert(write(fd, data, size) == (ssize_t) size);
+  assert(lseek(fd, 0, SEEK_SET) == 0);
+  return fd;
+}
+
+// vector_extend_from_fd(), vector_extend_from_fd_z()
+
+void test_vector_extend_from_fd(void) {
+  char *vector = vector_define(char, 'a', 'b');
+  int fd = temporary("cdefghij", 8);
+  ssize_t count;
+
+  // It appends at most max elements read from the file descriptor
+  vector = vector_extend_from_fd(vector, fd, 3, &count);
+  assert(count == 3);
+  assert_vector_data(vector, 'a', 'b', 'c', 'd', 'e');
+
+  // It appends only the elements actually read
+  vector = vector_extend_from_fd(vector, fd, 100, &count);
+  assert(count == 5);
+  assert_vector_data(vector, 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j');
+  assert(vector_volume(vector) >= 102);
+
+  // At the end of file it stores zero and leaves the vector unmodified
+  vector = vector_extend_from_fd(vector, fd, 100, &count);
+  assert(count == 0);
+  assert(vector_length(vector) == 10);
+
+  // When the read fails it stores -1 and retains errno
+  close(fd);
+  errno = 0;
+  vector = vector_extend_from_fd(vector, fd, 100, &count);
+  assert(vector != NULL);
+  assert(count == -1);
+  assert(errno == EBADF);
+  assert(vector_length(vector) == 10);
+
+  // When the volume overflows it returns NULL with errno set to ENOMEM
+  errno = 0;
+  assert(vector_extend_from_fd(vector, fd, SIZE_MAX, &count) == NULL);
+  assert(errno == ENOMEM);
+
+  vector_delete(vector);
+
+  // It discards the bytes of an incomplete element at the end of file
+  int data[] = { 1, 2, 3 };
+  int *numbers = vector_create();
+  fd = temporary(data, sizeof(data) - 1);
+  numbers = vector_extend_from_fd(numbers, fd, 10, &count);
+  assert(count == 2);
+  assert_vector_data(numbers, 1, 2);
+  close(fd);
+
+  vector_delete(numbers);
+}
+
+// vector_extend_from_fd_at(), vector_extend_from_fd_at_z()
+
+void test_vector_extend_from_fd_at(void) {
+  char *vector = vector_create();
+  int fd = temporary("abcdef", 6);
+  ssize_t count;
+
+  // It reads from the offset without changing the file offset
+  vector = vector_extend_from_fd_at(vector, fd, 2, 3, &count);
+  assert(count == 3);
+  assert_vector_data(vector, 'c', 'd', 'e');
+  assert(lseek(fd, 0, SEEK_CUR) == 0);
+
+  // At the end of file it stores zero
+  vector = vector_extend_from_fd_at(vector, fd, 6, 3, &count);
+  assert(count == 0);
+  assert(vector_length(vector) == 3);
+
+  close(fd);
+  vector_delete(vector);
+}
+
+// vector_extend_from_fdv(), vector_extend_from_fdv_z()
+
+void test_vector_extend_from_fdv(void) {
+  char *vector = vector_resize((char *) vector_create(), 4);
+  char data[3 * VECTOR_IO_BUFFER / 2];
+  ssize_t count;
+
+  for (size_t i = 0; i < sizeof(data); i++)
+    data[i] = (char) i;
+  int fd = temporary(data, sizeof(data));
+
+  // It reads into the volume of the vector without resizing it
+  char *prior = vector;
+  vector = vector_extend_from_fdv(vector, fd, 2, &count);
+  assert(count == 2);
+  assert(vector == prior);
+  assert(vector_volume(vector) == 4);
+  assert_vector_data(vector, 0, 1);
+
+  // It extends the vector by the elements read past its volume
+  vector = vector_extend_from_fdv(vector, fd, sizeof(data), &count);
+  assert(count == 2 + VECTOR_IO_BUFFER);
+  assert(vector_length(vector) == 4 + VECTOR_IO_BUFFER);
+  assert(!memcmp(vector, data, vector_length(vector)));
+
+  // It reads at most max elements
+  vector = vector_extend_from_fdv(vector, fd, 10, &count);
+  assert(count == 10);
+  assert(!memcmp(vector, data, vector_length(vector)));
+
+  // At the end of file it stores zero
+  while (count > 0)
+    vector = vector_extend_from_fdv(vector, fd, sizeof(data), &count);
+  assert(vector_length(vector) == sizeof(data));
+  assert(!memcmp(vector, data, sizeof(data)));
+
+  close(fd);
+  vector_delete(vector);
+
+  // When the extend fails it returns NULL and stores the number of elements
+  // read into the volume of the vector, which it retains
+  vector = vector_resize((char *) vector_create(), 4);
+  fd = temporary(data, sizeof(data));
+  realloc_fails = true;
+  errno = 0;
+  assert(vector_extend_from_fdv(vector, fd, sizeof(data), &count) == NULL);
+  realloc_fails = false;
+  assert(errno == ENOMEM);
+  assert(count == 4);
+  assert(vector_length(vector) == 4);
+  assert(!memcmp(vector, data, 4));
+
+  close(fd);
+  vector_delete(vector);
+}
+
+int main() {
+  test_vector_extend_from_fd();
+  test_vector_extend_from_fd_at();
+  test_vector_extend_from_fdv();
+}
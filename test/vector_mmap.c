@@ -0,0 +1,85 @@
+#include <assert.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "test.h"
+
+static size_t malloc_count = 0;
+__attribute__((used)) void *stub_malloc(size_t size) {
+  malloc_count++;
+  return malloc(size);
+}
+
+static size_t realloc_count = 0;
+__attribute__((used)) void *stub_realloc(void *data, size_t size) {
+  realloc_count++;
+  return realloc(data, size);
+}
+
+static size_t free_count = 0;
+__attribute__((used)) void stub_free(void *data) {
+  free_count++;
+  free(data);
+}
+
+void test_vector_mmap_using(const struct vector_allocator_t *allocator) {
+  size_t length = VECTOR_MMAP_THRESHOLD / sizeof(int);
+  int data[] = { 1, 2, 3, 5, 8, 13 };
+  int *vector;
+
+  // A small vector is passed to malloc() and realloc()
+  malloc_count = realloc_count = free_count = 0;
+  vector = vector_import_using(allocator, data, 6);
+  assert(malloc_count == 1);
+  vector = vector_extend(vector, data, 6);
+  assert(realloc_count == 1);
+
+  // When the vector crosses the threshold it's copied into a mapping
+  vector = vector_ensure(vector, length);
+  assert(malloc_count == 1);
+  assert(free_count == 1);
+  assert_vector_data(vector, 1, 2, 3, 5, 8, 13, 1, 2, 3, 5, 8, 13);
+
+  // Each element of the mapping is writable
+  vector[vector_volume(vector) - 1] = 21;
+
+  // A mapped vector is resized without malloc(), realloc(), or free()
+  vector = vector_ensure(vector, length * 2);
+  vector = vector_resize(vector, length * 3);
+  assert(malloc_count == 1);
+  assert(realloc_count == 1);
+  assert(free_count == 1);
+  assert_vector_data(vector, 1, 2, 3, 5, 8, 13, 1, 2, 3, 5, 8, 13);
+
+  // When the vector crosses the threshold again it's copied out of the
+  // mapping
+  vector = vector_shrink(vector);
+  assert(malloc_count == 2);
+  assert(free_count == 1);
+  assert_vector_data(vector, 1, 2, 3, 5, 8, 13, 1, 2, 3, 5, 8, 13);
+
+  // A small vector is passed to free() on delete but a mapped vector isn't
+  free_count = 0;
+  vector_delete(vector);
+  assert(free_count == 1);
+
+  vector = vector_create_using(allocator);
+  vector = vector_resize(vector, length);
+  free_count = 0;
+  vector_delete(vector);
+  assert(free_count == 0);
+}
+
+void test_vector_mmap(void) {
+  test_vector_mmap_using(&vector_mmap);
+}
+
+void test_vector_mmap_huge(void) {
+  test_vector_mmap_using(&vector_mmap_huge);
+}
+
+int main() {
+  test_vector_mmap();
+  test_vector_mmap_huge();
+}
@@ -47,6 +47,71 @@ void test_vector_move(void) {
   vector_delete(vector);
 }
 
+/* vector_rotate(), vector_rotate_z() */
+
+static size_t last_rotate_z;
+void vector_rotate_z(
+    vector_t vector, size_t i, size_t n, size_t k, size_t z) {
+  REAL(vector_rotate_z)(vector, i, n, k, last_rotate_z = z);
+}
+
+void test_vector_rotate(void) {
+  int *vector = vector_define(int, 1, 2, 3, 5, 8, 13);
+  int number = 0;
+
+  // It evaluates each argument once
+  vector_rotate((number++, vector), 0, 0, 0);
+  assert(number == 1);
+  vector_rotate(vector, (number++, 0), 0, 0);
+  assert(number == 2);
+  vector_rotate(vector, 0, (number++, 0), 0);
+  assert(number == 3);
+  vector_rotate(vector, 0, 0, (number++, 0));
+  assert(number == 4);
+
+  // It calls vector_rotate_z() with the element size of the vector
+  assert(last_rotate_z == sizeof(vector[0]));
+
+  // It rotates the range toward the head of the vector
+  vector_rotate(vector, 1, 4, 1);
+  assert_vector_data(vector, 1, 3, 5, 8, 2, 13);
+  vector_rotate(vector, 1, 4, 3);
+  assert_vector_data(vector, 1, 2, 3, 5, 8, 13);
+
+  // It rotates the whole vector by k modulo n
+  vector_rotate(vector, 0, 6, 8);
+  assert_vector_data(vector, 3, 5, 8, 13, 1, 2);
+
+  // When k is a multiple of n the vector is unmodified
+  vector_rotate(vector, 0, 6, 6);
+  assert_vector_data(vector, 3, 5, 8, 13, 1, 2);
+
+  vector_delete(vector);
+
+  // When both sides are larger than the buffer it block swaps them
+  size_t length = 1000;
+  vector = vector_create();
+  for (int i = 0; i < (int) length; i++)
+    vector = vector_append(vector, &i);
+  size_t shifts[] = { 1, 100, 333, 500, 667, 999 };
+  for (size_t s = 0; s < sizeof(shifts) / sizeof(shifts[0]); s++) {
+    vector_rotate(vector, 0, length, shifts[s]);
+    for (size_t i = 0; i < length; i++)
+      assert(vector[i] == (int) ((i + shifts[s]) % length));
+    vector_rotate(vector, 0, length, length - shifts[s]);
+  }
+
+  // When the sides are equal the block swaps complete the rotation without
+  // moving either side
+  struct vector_stats_t prior = vector_stats();
+  vector_rotate(vector, 0, length, length / 2);
+  assert(vector_stats().move_bytes == prior.move_bytes);
+  for (size_t i = 0; i < length; i++)
+    assert(vector[i] == (int) ((i + length / 2) % length));
+
+  vector_delete(vector);
+}
+
 /* vector_swap(), vector_swap_z() */
 
 static size_t last_swap_z;
@@ -82,9 +147,28 @@ void test_vector_swap(void) {
   assert_vector_data(vector, 1, 13, 3, 5, 8, 2);
 
   vector_delete(vector);
+
+  // It swaps each byte of an element of any size
+  size_t sizes[] = { 1, 2, 3, 4, 7, 8, 16, 24, 32, 61, 64, 100 };
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    size_t z = sizes[s];
+    unsigned char data[3 * 100];
+    for (size_t k = 0; k < 3 * z; k++)
+      data[k] = (unsigned char) k;
+
+    vector_t bytes = vector_import_z(data, 3, z);
+    vector_swap_z(bytes, 0, 2, z);
+    assert(!memcmp(bytes, data + 2 * z, z));
+    assert(!memcmp((char *) bytes + z, data + z, z));
+    assert(!memcmp((char *) bytes + 2 * z, data, z));
+    vector_swap_z(bytes, 1, 1, z);
+    assert(!memcmp((char *) bytes + z, data + z, z));
+    vector_delete(bytes);
+  }
 }
 
 int main() {
   test_vector_move();
+  test_vector_rotate();
   test_vector_swap();
 }
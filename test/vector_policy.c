@@ -0,0 +1,172 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector.h>
+#include "test.h"
+
+void test_vector_expand(void) {
+  size_t header = sizeof(struct __vector_header_t);
+
+  // It expands to 8/5 of the length rounded to the nearest integer
+  assert(vector_expand_8_5(0, 10, 1, NULL) == 16);
+  assert(vector_expand_8_5(0, 1, 1, NULL) == 2);
+
+  // It expands to twice the length or to 3/2 of the length
+  assert(vector_expand_2(0, 10, 1, NULL) == 20);
+  assert(vector_expand_3_2(0, 10, 1, NULL) == 15);
+
+  // When the expansion overflows it returns the length
+  assert(vector_expand_2(0, SIZE_MAX - 1, 1, NULL) == SIZE_MAX - 1);
+  assert(vector_expand_3_2(0, SIZE_MAX - 1, 1, NULL) == SIZE_MAX - 1);
+  assert(vector_expand_8_5(0, SIZE_MAX, 1, NULL) <= SIZE_MAX);
+
+  // It rounds the size of the allocation up to a page
+  size_t volume = vector_expand_page(0, 10, 4, NULL);
+  assert((header + volume * 4) % VECTOR_PAGE_SIZE == 0);
+  assert(volume == (VECTOR_PAGE_SIZE - header) / 4);
+
+  // It rounds the size of a small allocation up to a power of two
+  volume = vector_expand_class(0, 10, 4, NULL);
+  assert(header + volume * 4 == 128);
+
+  // It rounds the size of a large allocation up to a page
+  volume = vector_expand_class(0, VECTOR_PAGE_SIZE, 4, NULL);
+  assert((header + volume * 4) % VECTOR_PAGE_SIZE == 0);
+
+  // It rounds the length up to a multiple of the expansion
+  struct vector_policy_t policy = { .expansion = 16 };
+  assert(vector_expand_increment(0, 17, 1, &policy) == 32);
+  assert(vector_expand_increment(0, 32, 1, &policy) == 32);
+
+  // When the expansion is zero it doesn't preallocate
+  policy.expansion = 0;
+  assert(vector_expand_increment(0, 17, 1, &policy) == 17);
+}
+
+void test_vector_contract(void) {
+  // It contracts to 6/5 of the length once the length is no greater than half
+  // the volume
+  assert(vector_contract_half(21, 10, 1, NULL) == 12);
+  assert(vector_contract_half(20, 10, 1, NULL) == 20);
+  assert(vector_contract_half(0, 0, 1, NULL) == 0);
+
+  // It never contracts
+  assert(vector_contract_never(100, 0, 1, NULL) == 100);
+
+  // It contracts to 8/5 of the length once the length is no greater than the
+  // volume divided by the contraction
+  struct vector_policy_t policy = { .contraction = 4 };
+  assert(vector_contract_divisor(100, 26, 1, &policy) == 100);
+  assert(vector_contract_divisor(100, 25, 1, &policy) == 40);
+
+  // When the contraction is less than two it never contracts
+  policy.contraction = 1;
+  assert(vector_contract_divisor(100, 0, 1, &policy) == 100);
+}
+
+void test_vector_set_policy(void) {
+  static const struct vector_policy_t policy = {
+    .expand = vector_expand_increment,
+    .contract = vector_contract_never,
+    .expansion = 16,
+  };
+  int *vector = vector_create();
+
+  // When the vector isn't bound to a policy it uses the default policy
+  assert(vector_policy(vector) == NULL);
+  assert(__vector_policy(vector) == &vector_policy_default);
+
+  vector = vector_ensure(vector, 10);
+  assert(vector_volume(vector) == 16);
+
+  vector_set_policy(vector, &policy);
+  assert(vector_policy(vector) == &policy);
+  assert(__vector_policy(vector) == &policy);
+
+  // It expands the vector with the policy's expand function
+  vector = vector_ensure(vector, 17);
+  assert(vector_volume(vector) == 32);
+
+  // It contracts the vector with the policy's contract function
+  for (int i = 0; i < 17; i++)
+    vector = vector_append(vector, &i);
+  vector = vector_truncate(vector, 1);
+  assert(vector_volume(vector) == 32);
+
+  // A duplicate is bound to the same policy
+  int *duplicate = vector_duplicate(vector);
+  assert(vector_policy(duplicate) == &policy);
+  vector_delete(duplicate);
+
+  // When it's unbound the vector uses the default policy again
+  vector_set_policy(vector, NULL);
+  vector = vector_truncate(vector, 0);
+  assert(vector_volume(vector) == 0);
+
+  vector_delete(vector);
+}
+
+void test_vector_policy_slack(void) {
+  static const struct vector_policy_t policy = {
+    .expand = vector_expand_8_5,
+    .contract = vector_contract_half,
+    .slack = true,
+  };
+  size_t header = sizeof(struct __vector_header_t);
+  int *vector;
+
+  // It records the slack of an allocation in a size class as volume
+  vector = vector_create_using(&vector_cache);
+  vector_set_policy(vector, &policy);
+  vector = vector_resize(vector, 1);
+  size_t volume = (VECTOR_CACHE_MINIMUM - header) / sizeof(int);
+  assert(vector_volume(vector) == volume);
+  assert(vector_length(vector) == 0);
+
+  // An insertion that fits in the slack doesn't resize the vector
+  int *prior = vector;
+  for (int i = 0; i < (int) vector_volume(prior); i++)
+    vector = vector_append(vector, &i);
+  assert(vector == prior);
+  assert(vector_volume(vector) == vector_length(vector));
+  vector_delete(vector);
+  vector_cache_flush();
+
+  // When the allocator doesn't know the usable size the volume is exact
+  struct vector_allocator_t allocator = vector_cache;
+  allocator.usable = NULL;
+  vector = vector_create_using(&allocator);
+  vector_set_policy(vector, &policy);
+  vector = vector_resize(vector, 1);
+  assert(vector_volume(vector) == 1);
+  vector_delete(vector);
+  vector_cache_flush();
+
+  // Without an allocator the volume is at least the requested volume
+  vector = vector_create();
+  vector_set_policy(vector, &vector_policy_class);
+  vector = vector_resize(vector, 3);
+  assert(vector_volume(vector) >= 3);
+
+  // When it's resized below its length the vector is truncated to the
+  // requested volume rather than to the slack
+  for (int i = 0; i < 100; i++)
+    vector = vector_append(vector, &i);
+  vector = vector_resize(vector, 3);
+  assert(vector_length(vector) == 3);
+  assert(vector_volume(vector) >= 3);
+  assert_vector_data(vector, 0, 1, 2);
+  vector = vector_resize(vector, 1);
+  assert(vector_length(vector) == 1);
+  assert_vector_data(vector, 0);
+  vector_delete(vector);
+}
+
+int main() {
+  test_vector_expand();
+  test_vector_contract();
+  test_vector_set_policy();
+  test_vector_policy_slack();
+}
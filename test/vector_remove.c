@@ -1,5 +1,6 @@
 #include <assert.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdlib.h>
 
@@ -104,6 +105,97 @@ void test_vector_remove(void) {
   vector_delete(result);
 }
 
+// vector_excise_indices(), vector_excise_indices_z()
+
+void test_vector_excise_indices(void) {
+  int *vector = vector_define(int, 1, 2, 3, 5, 8, 13, 21, 34, 55, 89);
+  int number = 0;
+
+  // It evaluates each argument once
+  vector = vector_excise_indices((number++, vector), NULL, 0);
+  assert(number == 1);
+
+  // With no indices it returns the vector unmodified
+  assert_vector_data(vector, 1, 2, 3, 5, 8, 13, 21, 34, 55, 89);
+
+  // It removes the element at each index and retains the order of the rest
+  size_t indices[] = { 0, 2, 3, 3, 9 };
+  vector = vector_excise_indices(vector, indices, 5);
+  assert_vector_data(vector, 2, 8, 13, 21, 34, 55);
+
+  // It applies the shrink policy once the elements are removed
+  size_t all[] = { 0, 1, 2, 3, 4, 5 };
+  vector = vector_excise_indices(vector, all, 5);
+  assert_vector_data(vector, 55);
+  assert(vector_volume(vector) == (1 * 6 + 4) / 5);
+
+  vector = vector_excise_indices(vector, all, 1);
+  assert(vector_length(vector) == 0);
+
+  vector_delete(vector);
+}
+
+// vector_excise_bitmap(), vector_excise_bitmap_z()
+
+void test_vector_excise_bitmap(void) {
+  int *vector = vector_create();
+  int number = 0;
+
+  for (int i = 0; i < 20; i++)
+    vector = vector_append(vector, &i);
+
+  // It evaluates each argument once
+  unsigned char none[3] = { 0 };
+  vector = vector_excise_bitmap((number++, vector), none);
+  assert(number == 1);
+
+  // With no bits set it returns the vector unmodified
+  assert(vector_length(vector) == 20);
+
+  // It removes the element at each index whose bit is set
+  unsigned char bitmap[3] = { 0x81, 0x00, 0x0a };
+  vector = vector_excise_bitmap(vector, bitmap);
+  assert_vector_data(vector, 1, 2, 3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 15,
+      16, 18);
+
+  // With each bit set it empties the vector
+  unsigned char each[2] = { 0xff, 0xff };
+  vector = vector_excise_bitmap(vector, each);
+  assert(vector_length(vector) == 0);
+
+  vector_delete(vector);
+}
+
+// vector_swap_remove(), vector_swap_remove_z()
+
+void test_vector_swap_remove(void) {
+  int *vector = vector_define(int, 1, 2, 3, 5, 8, 13);
+  int number = 0;
+
+  // It evaluates each argument once
+  vector = vector_swap_remove((number++, vector), 5);
+  assert(number == 1);
+  vector = vector_swap_remove(vector, (number++, 4));
+  assert(number == 2);
+
+  // It removes the last element without moving any other element
+  assert_vector_data(vector, 1, 2, 3, 5);
+
+  // It replaces the element with the last element
+  vector = vector_swap_remove(vector, 0);
+  assert_vector_data(vector, 5, 2, 3);
+  vector = vector_swap_remove(vector, 1);
+  assert_vector_data(vector, 5, 3);
+
+  // It applies the shrink policy to the vector
+  vector = vector_swap_remove(vector, 0);
+  vector = vector_swap_remove(vector, 0);
+  assert(vector_length(vector) == 0);
+  assert(vector_volume(vector) == 0);
+
+  vector_delete(vector);
+}
+
 // vector_truncate(), vector_truncate_z()
 
 static size_t last_truncate_z;
@@ -141,8 +233,120 @@ void test_vector_truncate(void) {
   vector_delete(result);
 }
 
+void test_vector_excise_pinned(void) {
+  int *vector = vector_define(int, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10);
+  size_t volume = vector_volume(vector);
+
+  // A vector isn't pinned when it's created
+  assert(!vector_pinned(vector));
+
+  vector_pin(vector);
+  assert(vector_pinned(vector));
+
+  // When the vector is pinned it doesn't reduce the volume of the vector
+  vector = vector_excise(vector, 2, 8);
+  assert_vector_data(vector, 1, 2);
+  assert(vector_volume(vector) == volume);
+
+  vector = vector_truncate(vector, 0);
+  assert(vector_length(vector) == 0);
+  assert(vector_volume(vector) == volume);
+
+  // A duplicate of a pinned vector is pinned
+  int *duplicate = vector_duplicate(vector);
+  assert(vector_pinned(duplicate));
+  vector_delete(duplicate);
+
+  // An explicit shrink reduces the volume of a pinned vector
+  vector = vector_shrink(vector);
+  assert(vector_volume(vector) == 0);
+  assert(vector_pinned(vector));
+
+  // When the vector is unpinned it reduces the volume of the vector again
+  vector_unpin(vector);
+  assert(!vector_pinned(vector));
+  for (int i = 0; i < 10; i++)
+    vector = vector_append(vector, &i);
+  vector = vector_truncate(vector, 1);
+  assert(vector_volume(vector) < volume);
+
+  vector_delete(vector);
+}
+
+// vector_remove_if(), vector_retain(), and their _with variants
+
+static size_t test_count;
+static bool is_odd(const void *elmt) {
+  test_count++;
+  return *(const int *) elmt % 2 != 0;
+}
+
+static bool is_multiple(const void *elmt, void *data) {
+  test_count++;
+  return *(const int *) elmt % *(int *) data == 0;
+}
+
+void test_vector_remove_if(void) {
+  int *vector = vector_define(int, 1, 2, 3, 5, 8, 13, 21, 34, 55, 89);
+  int number = 0;
+
+  // It evaluates each argument once
+  vector = vector_remove_if((number++, vector), is_odd);
+  assert(number == 1);
+
+  // It tests each element once and removes each element that satisfies the
+  // test in order
+  assert_vector_data(vector, 2, 8, 34);
+
+  vector_delete(vector);
+
+  vector = vector_define(int, 1, 2, 3, 5, 8, 13, 21, 34, 55, 89);
+  test_count = 0;
+  vector = vector_retain(vector, is_odd);
+  assert(test_count == 10);
+  assert_vector_data(vector, 1, 3, 5, 13, 21, 55, 89);
+
+  // It passes the data as the last argument to the test
+  int three = 3;
+  test_count = 0;
+  vector = vector_remove_if_with(vector, is_multiple, &three);
+  assert(test_count == 7);
+  assert_vector_data(vector, 1, 5, 13, 55, 89);
+
+  int five = 5;
+  vector = vector_retain_with(vector, is_multiple, &five);
+  assert_vector_data(vector, 5, 55);
+
+  // It applies the shrink policy once the elements are removed
+  vector_delete(vector);
+  vector = vector_define(int, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+      11, 12, 13, 14, 15, 16, 17, 18, 19, 20);
+  vector = vector_retain_with(vector, is_multiple, &five);
+  assert_vector_data(vector, 5, 10, 15, 20);
+  assert(vector_volume(vector) == (4 * 6 + 4) / 5);
+
+  // When nothing is removed the vector is unmodified
+  int seven = 7;
+  vector = vector_remove_if_with(vector, is_multiple, &seven);
+  assert_vector_data(vector, 5, 10, 15, 20);
+  vector = vector_retain_with(vector, is_multiple, &five);
+  assert_vector_data(vector, 5, 10, 15, 20);
+
+  // When everything is removed the vector is empty
+  vector = vector_retain(vector, is_odd);
+  vector = vector_remove_if(vector, is_odd);
+  assert(vector_length(vector) == 0);
+
+  vector_delete(vector);
+}
+
 int main() {
   test_vector_remove();
   test_vector_excise();
+  test_vector_excise_pinned();
+  test_vector_excise_indices();
+  test_vector_excise_bitmap();
+  test_vector_swap_remove();
   test_vector_truncate();
+  test_vector_remove_if();
 }
@@ -0,0 +1,177 @@
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "test.h"
+
+// vector_ring(), vector_unring(), vector_unring_z(), vector_ringed()
+
+void test_vector_ring(void) {
+  int *vector = vector_define(int, 1, 2, 3, 5, 8, 13);
+  int elmt;
+
+  // A vector isn't a ring until vector_ring()
+  assert(!vector_ringed(vector));
+  assert(vector_ring(vector) == vector);
+  assert(vector_ringed(vector));
+
+  // It shifts without moving the elements in its storage
+  int *storage = vector = vector_resize(vector, 8);
+  vector = vector_shift(vector, &elmt);
+  assert(elmt == 1);
+  vector = vector_shift(vector, &elmt);
+  assert(elmt == 2);
+  assert(vector == storage);
+  assert(vector_length(vector) == 4);
+  assert(vector_ring_at(vector, 0, sizeof(int)) == &storage[2]);
+  assert(*vector_ring_at(vector, 3, sizeof(int)) == 13);
+
+  // It pushes elements around to the start of its storage
+  int data[] = { 21, 34, 55 };
+  for (size_t i = 0; i < sizeof(data) / sizeof(data[0]); i++)
+    vector = vector_push(vector, &data[i]);
+  assert(vector == storage);
+  assert(vector_ring_at(vector, 6, sizeof(int)) == &storage[0]);
+  assert(storage[0] == 55);
+
+  // It unshifts an element before the first element in its storage
+  elmt = 2;
+  vector = vector_unshift(vector, &elmt);
+  assert(vector == storage);
+  assert(vector_ring_at(vector, 0, sizeof(int)) == &storage[1]);
+  assert(storage[1] == 2);
+
+  // It pulls the last element even if it wraps around
+  vector = vector_pull(vector, &elmt);
+  assert(elmt == 55);
+  assert(vector_length(vector) == 7);
+
+  // When unringed it moves the elements to the start of its storage
+  vector_unring(vector);
+  assert(!vector_ringed(vector));
+  assert_vector_data(vector, 2, 3, 5, 8, 13, 21, 34);
+
+  // It unshifts an element at the start of its storage around to its end
+  assert(vector_ring(vector) == vector);
+  elmt = 1;
+  vector = vector_unshift(vector, &elmt);
+  assert(vector == storage);
+  assert(storage[7] == 1);
+  vector_unring(vector);
+  assert_vector_data(vector, 1, 2, 3, 5, 8, 13, 21, 34);
+
+  vector_delete(vector);
+}
+
+// vector_segments(), vector_segments_z()
+
+void test_vector_segments(void) {
+  int *vector = vector_create();
+  struct vector_segment_t segment[2];
+
+  // When the length of the vector is zero it stores no run
+  assert(vector_segments(vector, segment) == 0);
+  vector_delete(vector);
+
+  // When the vector isn't a ring it stores a single run
+  vector = vector_define(int, 1, 2, 3);
+  assert(vector_segments(vector, segment) == 1);
+  assert(segment[0].data == vector);
+  assert(segment[0].length == 3);
+  vector_delete(vector);
+
+  // When the elements of a ring wrap around it stores two runs in order
+  vector = vector_ensure((int *) vector_create(), 4);
+  vector = vector_resize(vector, 4);
+  assert(vector_ring(vector) == vector);
+  for (int i = 0; i < 4; i++)
+    vector = vector_push(vector, &i);
+  vector = vector_shift(vector, NULL);
+  vector = vector_shift(vector, NULL);
+  int elmt = 4;
+  vector = vector_push(vector, &elmt);
+  assert(vector_segments(vector, segment) == 2);
+  assert(segment[0].data == &vector[2]);
+  assert(segment[0].length == 2);
+  assert(segment[1].data == &vector[0]);
+  assert(segment[1].length == 1);
+  assert(vector[2] == 2 && vector[3] == 3 && vector[0] == 4);
+
+  vector_delete(vector);
+}
+
+// vector_resize(), vector_duplicate()
+
+void test_vector_ring_resize(void) {
+  int *vector = vector_resize((int *) vector_create(), 4);
+  assert(vector_ring(vector) == vector);
+
+  // Fill the ring such that its elements wrap around its storage
+  for (int i = 0; i < 4; i++)
+    vector = vector_push(vector, &i);
+  vector = vector_shift(vector, NULL);
+  vector = vector_shift(vector, NULL);
+  for (int i = 4; i < 6; i++)
+    vector = vector_push(vector, &i);
+  assert(vector_length(vector) == 4);
+  assert(vector_volume(vector) == 4);
+  assert(vector[0] == 4);
+
+  // It duplicates the elements of a ring in order
+  int *duplicate = vector_duplicate(vector);
+  assert_vector_data(duplicate, 2, 3, 4, 5);
+  vector_delete(duplicate);
+
+  // When it grows it moves the elements to the start of the storage
+  int elmt = 6;
+  vector = vector_push(vector, &elmt);
+  assert(vector_ringed(vector));
+  assert_vector_data(vector, 2, 3, 4, 5, 6);
+
+  // When it contracts it moves the elements to the start of the storage
+  for (int i = 0; i < 3; i++)
+    vector = vector_shift(vector, NULL);
+  elmt = 7;
+  vector = vector_unshift(vector, &elmt);
+  assert(vector_length(vector) == 3);
+  vector = vector_shrink(vector);
+  assert_vector_data(vector, 7, 5, 6);
+
+  // When the last element is shifted it starts at its storage again
+  while (vector_length(vector) > 0)
+    vector = vector_shift(vector, NULL);
+  elmt = 8;
+  vector = vector_push(vector, &elmt);
+  assert_vector_data(vector, 8);
+
+  // It fails to grow a ring beyond the volume that its head can index
+  char *bytes = vector_create();
+  assert(vector_ring(bytes) == bytes);
+  errno = 0;
+  assert(vector_resize(bytes, __VECTOR_RING_VOLUME_MAX + 1) == NULL);
+  assert(errno == ENOMEM);
+  assert(vector_ringed(bytes));
+  vector_delete(bytes);
+
+  // It fails to make a ring of a vector whose volume its head can't index
+  vector_unring(vector);
+  struct __vector_header_t *header = __vector_to_header((vector_t) vector);
+  size_t volume = header->volume;
+  header->volume = __VECTOR_RING_VOLUME_MAX + 1;
+  errno = 0;
+  assert(vector_ring(vector) == NULL);
+  assert(errno == ENOMEM);
+  assert(!vector_ringed(vector));
+  header->volume = volume;
+
+  vector_delete(vector);
+}
+
+int main() {
+  test_vector_ring();
+  test_vector_segments();
+  test_vector_ring_resize();
+}
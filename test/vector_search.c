@@ -1,7 +1,9 @@
 #include <assert.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <vector.h>
 #include "test.h"
@@ -186,6 +188,120 @@ void test_vector_find_last(void) {
   vector_delete(vector);
 }
 
+// vector_find_value(), vector_find_value_z()
+
+static size_t last_find_value_next_z;
+size_t vector_find_value_next_z(
+    vector_c vector, size_t i, const void *elmt, size_t z) {
+  return REAL(vector_find_value_next_z)(
+      vector, i, elmt, last_find_value_next_z = z);
+}
+
+static size_t last_find_value_last_z;
+size_t vector_find_value_last_z(
+    vector_c vector, size_t i, const void *elmt, size_t z) {
+  return REAL(vector_find_value_last_z)(
+      vector, i, elmt, last_find_value_last_z = z);
+}
+
+void test_vector_find_value(void) {
+  int *vector = vector_define(int, 1, 2, 2, 3, 3, 3, 5, 5, 5, 5, 5);
+  int elmt = 3;
+  int number = 0;
+  size_t result;
+
+  // It evaluates each argument once
+  result = vector_find_value((number++, vector), &elmt);
+  assert(number == 1);
+  result = vector_find_value(vector, (number++, &elmt));
+  assert(number == 2);
+  result = vector_find_value_next((number++, vector), 0, &elmt);
+  assert(number == 3);
+  result = vector_find_value_next(vector, (number++, 0), &elmt);
+  assert(number == 4);
+  result = vector_find_value_next(vector, 0, (number++, &elmt));
+  assert(number == 5);
+  result = vector_find_value_last((number++, vector), 0, &elmt);
+  assert(number == 6);
+  result = vector_find_value_last(vector, (number++, 0), &elmt);
+  assert(number == 7);
+  result = vector_find_value_last(vector, 0, (number++, &elmt));
+  assert(number == 8);
+
+  // It calls vector_find_value_next_z() and vector_find_value_last_z() with
+  // the element size of the vector
+  assert(last_find_value_next_z == sizeof(vector[0]));
+  assert(last_find_value_last_z == sizeof(vector[0]));
+
+  // It returns the index of the first element equal to the element
+  result = vector_find_value(vector, &elmt);
+  assert(result == 3);
+  assert(vector_find_value_next(vector, 4, &elmt) == 4);
+
+  // It returns the index of the last element equal to the element
+  result = vector_find_value_last(vector, vector_length(vector), &elmt);
+  assert(result == 5);
+  assert(vector_find_value_last(vector, 5, &elmt) == 4);
+
+  // When no such element is in the vector it returns SIZE_MAX
+  elmt = 4;
+  assert(vector_find_value(vector, &elmt) == SIZE_MAX);
+  elmt = 1;
+  assert(vector_find_value_next(vector, 1, &elmt) == SIZE_MAX);
+  assert(vector_find_value_last(vector, 0, &elmt) == SIZE_MAX);
+  assert(vector_find_value_next(vector, vector_length(vector), &elmt)
+      == SIZE_MAX);
+
+  vector_delete(vector);
+
+  // With elements of each size it finds an element at each index from either
+  // end and not the bytes of an element split across two elements. The lengths
+  // are around the four blocks of 16 (SSE2) and 32 (AVX2) bytes that are
+  // compared at a time, so that both the blocks and the rest are searched.
+  size_t sizes[] = { 1, 2, 3, 4, 8, 12, 16 };
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    for (size_t l = 0; l < 7; l++) {
+      size_t z = sizes[s], lengths[] = {
+        4 * 16 / z - 1, 4 * 16 / z, 4 * 16 / z + 1,
+        4 * 32 / z - 1, 4 * 32 / z, 4 * 32 / z + 1, 300 / z,
+      };
+      size_t length = lengths[l];
+      unsigned char key[16], other[16];
+      vector_t bytes = vector_create();
+
+      // every other element is the key rotated by a byte so that the bytes of
+      // the key straddle each pair of elements
+      for (size_t k = 0; k < z; k++)
+        key[k] = (unsigned char) (0xA0 + k);
+      for (size_t k = 0; k < z; k++)
+        other[k] = z == 1 ? 0 : key[(k + 1) % z];
+      for (size_t i = 0; i < length; i++) {
+        vector_t result = vector_extend_z(bytes, other, 1, z);
+        assert(result != NULL);
+        bytes = result;
+      }
+      assert(vector_find_value_z(bytes, key, z) == SIZE_MAX);
+      assert(vector_find_value_last_z(bytes, length, key, z) == SIZE_MAX);
+
+      for (size_t i = 0; i < length; i++) {
+        unsigned char prior[16];
+        memcpy(prior, vector_at(bytes, i, z), z);
+        memcpy(vector_at(bytes, i, z), key, z);
+        assert(vector_find_value_z(bytes, key, z) == i);
+        assert(vector_find_value_next_z(bytes, i, key, z) == i);
+        assert(vector_find_value_last_z(bytes, length, key, z) == i);
+        assert(vector_find_value_last_z(bytes, i + 1, key, z) == i);
+        assert(vector_find_value_last_z(bytes, i, key, z) == SIZE_MAX);
+        if (i + 1 < length)
+          assert(vector_find_value_next_z(bytes, i + 1, key, z) == SIZE_MAX);
+        memcpy(vector_at(bytes, i, z), prior, z);
+      }
+
+      vector_delete(bytes);
+    }
+  }
+}
+
 // vector_search(), vector_search_z()
 
 static int cmpintp_parity(const void *a, const void *b) {
@@ -199,6 +315,19 @@ static int cmpintp_parity(const void *a, const void *b) {
   return ra < rb ? -1 : (ra > rb ? 1 : 0);
 }
 
+struct entry {
+  const char *name;
+  int key;
+};
+
+static const int *search_key;
+static int cmpkey_entry(const void *a, const void *b) {
+  assert(a == search_key);
+  int key = *(const int *) a;
+  const struct entry *entry = b;
+  return key < entry->key ? -1 : (key > entry->key ? 1 : 0);
+}
+
 static size_t last_search_z;
 size_t vector_search_z(
     vector_c vector,
@@ -242,11 +371,239 @@ void test_vector_search(void) {
   assert(result == SIZE_MAX);
 
   vector_delete(vector);
+
+  // It passes the element to search for to the function first as bsearch()
+  // does, so the element can have a different type than those in the vector
+  struct entry *entries = vector_define(struct entry,
+      { "one", 1 }, { "two", 2 }, { "three", 3 }, { "five", 5 });
+  search_key = &elmt;
+  elmt = 3;
+  assert(vector_search(entries, &elmt, cmpkey_entry) == 2);
+  elmt = 4;
+  assert(vector_search(entries, &elmt, cmpkey_entry) == SIZE_MAX);
+  elmt = 6;
+  assert(vector_search(entries, &elmt, cmpkey_entry) == SIZE_MAX);
+  vector_delete(entries);
+}
+
+// vector_lower_bound(), vector_upper_bound(), vector_equal_range() and their
+// contextual and explicit analogues
+
+static int cmpintp(const void *a, const void *b) {
+  int ra = *(const int *) a;
+  int rb = *(const int *) b;
+  return ra < rb ? -1 : (ra > rb ? 1 : 0);
+}
+
+static int cmpintp_with(const void *a, const void *b, void *data) {
+  ++*(size_t *) data;
+  return cmpintp(a, b);
+}
+
+void test_vector_bound(void) {
+  int *vector = vector_define(int, 1, 3, 3, 3, 5, 5, 8);
+  int elmt = 3;
+  int number = 0;
+  size_t end, result;
+
+  // It evaluates each argument once
+  result = vector_lower_bound((number++, vector), &elmt, cmpintp);
+  assert(number == 1);
+  result = vector_upper_bound(vector, (number++, &elmt), cmpintp);
+  assert(number == 2);
+  result = vector_equal_range(vector, &elmt, cmpintp, (number++, &end));
+  assert(number == 3);
+
+  // It returns the index of the first element not less than the element
+  result = vector_lower_bound(vector, &elmt, cmpintp);
+  assert(result == 1);
+
+  // It returns the index of the first element greater than the element
+  result = vector_upper_bound(vector, &elmt, cmpintp);
+  assert(result == 4);
+
+  // It returns the lower bound and stores the upper bound
+  result = vector_equal_range(vector, &elmt, cmpintp, &end);
+  assert(result == 1 && end == 4);
+
+  // When the element isn't in the vector it returns the index to insert it at
+  int missing[] = { 0, 2, 4, 6, 9 };
+  size_t index[] = { 0, 1, 4, 6, 7 };
+  for (size_t k = 0; k < sizeof(missing) / sizeof(missing[0]); k++) {
+    assert(vector_lower_bound(vector, &missing[k], cmpintp) == index[k]);
+    assert(vector_upper_bound(vector, &missing[k], cmpintp) == index[k]);
+    result = vector_equal_range(vector, &missing[k], cmpintp, &end);
+    assert(result == index[k] && end == index[k]);
+  }
+
+  // It passes the data to the contextual comparator
+  size_t count = 0;
+  elmt = 5;
+  result = vector_lower_bound_with(vector, &elmt, cmpintp_with, &count);
+  assert(result == 4);
+  assert(count > 0);
+  result = vector_upper_bound_with(vector, &elmt, cmpintp_with, &count);
+  assert(result == 6);
+  result = vector_equal_range_with(vector, &elmt, cmpintp_with, &count, &end);
+  assert(result == 4 && end == 6);
+
+  vector_delete(vector);
+
+  // With an empty vector it returns zero
+  vector = vector_create();
+  assert(vector_lower_bound(vector, &elmt, cmpintp) == 0);
+  assert(vector_upper_bound(vector, &elmt, cmpintp) == 0);
+  assert(vector_equal_range(vector, &elmt, cmpintp, &end) == 0 && end == 0);
+
+  // With many equal elements it makes a logarithmic number of comparisons
+  for (int i = 0; i < 1 << 16; i++) {
+    int value = i < 10 ? 0 : (i < (1 << 16) - 10 ? 1 : 2);
+    int *appended = vector_append(vector, &value);
+    assert(appended != NULL);
+    vector = appended;
+  }
+  elmt = 1;
+  count = 0;
+  result = vector_equal_range_with(vector, &elmt, cmpintp_with, &count, &end);
+  assert(result == 10 && end == (1 << 16) - 10);
+  assert(count <= 2 * (16 + 2));
+
+  // It agrees with a linear search at each length and element
+  vector_delete(vector);
+  vector = vector_create();
+  for (int length = 0; length < 40; length++) {
+    for (int e = -1; e <= length / 3 + 1; e++) {
+      size_t lower = 0, upper = 0;
+      while (lower < (size_t) length && vector[lower] < e)
+        lower++;
+      while (upper < (size_t) length && vector[upper] <= e)
+        upper++;
+      assert(vector_lower_bound(vector, &e, cmpintp) == lower);
+      assert(vector_upper_bound(vector, &e, cmpintp) == upper);
+    }
+    int value = length / 3;
+    int *appended = vector_append(vector, &value);
+    assert(appended != NULL);
+    vector = appended;
+  }
+
+  vector_delete(vector);
+
+  // It passes the element to search for to the function first as
+  // vector_search() does, so the same key comparator works with both
+  struct entry *entries = vector_define(struct entry,
+      { "one", 1 }, { "three", 3 }, { "three", 3 }, { "five", 5 });
+  search_key = &elmt;
+  elmt = 3;
+  assert(vector_lower_bound(entries, &elmt, cmpkey_entry) == 1);
+  assert(vector_upper_bound(entries, &elmt, cmpkey_entry) == 3);
+  result = vector_equal_range(entries, &elmt, cmpkey_entry, &end);
+  assert(result == 1 && end == 3);
+  elmt = 4;
+  assert(vector_lower_bound(entries, &elmt, cmpkey_entry) == 3);
+  assert(vector_upper_bound(entries, &elmt, cmpkey_entry) == 3);
+  vector_delete(entries);
+}
+
+// vector_search_many(), vector_search_many_z()
+
+static const int *many_keys;
+static size_t many_nkeys;
+static int cmpintp_many(const void *a, const void *b) {
+  const int *key = a;
+  assert(key >= many_keys && key < many_keys + many_nkeys);
+  return cmpintp(a, b);
+}
+
+static size_t last_search_many_z;
+void vector_search_many_z(
+    vector_c vector,
+    const void *keys,
+    size_t nkeys,
+    int (*cmpf)(const void *a, const void *b),
+    size_t *out,
+    size_t z) {
+  REAL(vector_search_many_z)(
+      vector, keys, nkeys, cmpf, out, last_search_many_z = z);
+}
+
+void test_vector_search_many(void) {
+  int *vector = vector_define(int, 1, 3, 3, 3, 5, 5, 8);
+  int keys[] = { 8, 0, 3, 9, 5, 1, 4 };
+  size_t out[7];
+  int number = 0;
+
+  // It evaluates each argument once
+  vector_search_many((number++, vector), keys, 0, cmpintp, out);
+  assert(number == 1);
+  vector_search_many(vector, (number++, keys), 0, cmpintp, out);
+  assert(number == 2);
+  vector_search_many(vector, keys, (number++, 0), cmpintp, out);
+  assert(number == 3);
+  vector_search_many(vector, keys, 0, (number++, cmpintp), out);
+  assert(number == 4);
+  vector_search_many(vector, keys, 0, cmpintp, (number++, out));
+  assert(number == 5);
+
+  // It calls vector_search_many_z() with the element size of the vector
+  assert(last_search_many_z == sizeof(vector[0]));
+
+  // With unsorted keys it stores the index of the first equal element of each
+  // key or SIZE_MAX
+  vector_search_many(vector, keys, 7, cmpintp, out);
+  assert(out[0] == 6 && out[1] == SIZE_MAX && out[2] == 1);
+  assert(out[3] == SIZE_MAX && out[4] == 4 && out[5] == 0);
+  assert(out[6] == SIZE_MAX);
+
+  // With sorted keys it stores the same indices
+  int sorted[] = { 0, 1, 3, 3, 4, 5, 9 };
+  vector_search_many(vector, sorted, 7, cmpintp, out);
+  assert(out[0] == SIZE_MAX && out[1] == 0 && out[2] == 1 && out[3] == 1);
+  assert(out[4] == SIZE_MAX && out[5] == 4 && out[6] == SIZE_MAX);
+
+  // It agrees with vector_search() for many keys in either order
+  vector = vector_truncate(vector, 0);
+  for (int i = 0; i < 1000; i++) {
+    int value = i / 3 * 2;
+    int *appended = vector_append(vector, &value);
+    assert(appended != NULL);
+    vector = appended;
+  }
+  int many[1000];
+  size_t result[1000];
+  for (int k = 0; k < 1000; k++)
+    many[k] = k * 7919 % 701 - 10;
+  vector_search_many(vector, many, 1000, cmpintp, result);
+  for (int k = 0; k < 1000; k++)
+    assert(result[k] == vector_search(vector, &many[k], cmpintp));
+  for (int k = 0; k < 1000; k++)
+    many[k] = k * 2 / 3 - 10;
+  vector_search_many(vector, many, 1000, cmpintp, result);
+  for (int k = 0; k < 1000; k++)
+    assert(result[k] == vector_search(vector, &many[k], cmpintp));
+
+  // It passes the key to the function first as vector_search() does
+  many_keys = many, many_nkeys = 1000;
+  vector_search_many(vector, many, 1000, cmpintp_many, result);
+  for (int k = 0; k < 1000; k++)
+    many[k] = k * 7919 % 701 - 10;
+  vector_search_many(vector, many, 1000, cmpintp_many, result);
+
+  // With an empty vector it stores SIZE_MAX for each key
+  vector = vector_truncate(vector, 0);
+  vector_search_many(vector, keys, 7, cmpintp, out);
+  for (int k = 0; k < 7; k++)
+    assert(out[k] == SIZE_MAX);
+
+  vector_delete(vector);
 }
 
 int main() {
   test_vector_find_next();
   test_vector_find();
   test_vector_find_last();
+  test_vector_find_value();
   test_vector_search();
+  test_vector_bound();
+  test_vector_search_many();
 }
@@ -97,9 +97,39 @@ void test_vector_shift(void) {
   vector_delete(vector);
 }
 
+// vector_unshift(), vector_unshift_z()
+
+static size_t last_unshift_z;
+vector_t vector_unshift_z(vector_t vector, const void *elmt, size_t z) {
+  return REAL(vector_unshift_z)(vector, elmt, last_unshift_z = z);
+}
+
+void test_vector_unshift(void) {
+  int *vector = vector_define(int, 2, 3, 5);
+  int elmt = 1;
+  int number = 0;
+
+  // It evaluates each argument once
+  vector = vector_unshift((number++, vector), &elmt);
+  assert(number == 1);
+  vector = vector_unshift(vector, (number++, &elmt));
+  assert(number == 2);
+
+  // It calls vector_unshift_z() with the element size of the vector
+  assert(last_unshift_z == sizeof(int));
+
+  // It inserts the element as the first element of the vector
+  elmt = 0;
+  vector = vector_unshift(vector, &elmt);
+  assert_vector_data(vector, 0, 1, 1, 2, 3, 5);
+
+  vector_delete(vector);
+}
+
 int main() {
   assert(!strcmp(DEFINITION_SOURCE(vector_push), "vector_append"));
   assert(!strcmp(DEFINITION_SOURCE(vector_push_z), "vector_append_z"));
   test_vector_pull();
   test_vector_shift();
+  test_vector_unshift();
 }
@@ -0,0 +1,87 @@
+#include <assert.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "test.h"
+
+static int realloc_errno = 0;
+__attribute__((used)) void *stub_realloc(void *data, size_t size) {
+  if (realloc_errno != 0)
+    return errno = realloc_errno, NULL;
+  return realloc(data, size);
+}
+
+void test_vector_stats(void) {
+  struct vector_stats_t prior, stats;
+  size_t header = sizeof(struct __vector_header_t);
+  int data[] = { 1, 2, 3, 5, 8, 13 };
+  int *vector;
+
+  // It counts each allocation
+  prior = vector_stats();
+  vector = vector_import(data, 6);
+  stats = vector_stats();
+  assert(stats.allocate == prior.allocate + 1);
+  assert(stats.allocate_bytes == prior.allocate_bytes + header + 6 * 4);
+  assert(stats.reallocate == prior.reallocate);
+  assert(stats.reallocate_bytes == prior.reallocate_bytes);
+
+  // It counts each reallocation apart from allocations, and each resize that
+  // increases the volume as growth
+  prior = stats;
+  vector = vector_resize(vector, 10);
+  stats = vector_stats();
+  assert(stats.allocate == prior.allocate);
+  assert(stats.allocate_bytes == prior.allocate_bytes);
+  assert(stats.reallocate == prior.reallocate + 1);
+  assert(stats.reallocate_bytes == prior.reallocate_bytes + header + 10 * 4);
+  assert(stats.grow == prior.grow + 1);
+  assert(stats.shrink == prior.shrink);
+
+  // It counts each resize that reduces the volume as a shrink
+  prior = stats;
+  vector = vector_shrink(vector);
+  stats = vector_stats();
+  assert(stats.grow == prior.grow);
+  assert(stats.shrink == prior.shrink + 1);
+
+  // It counts the bytes moved by an insertion
+  prior = stats;
+  vector = vector_insert(vector, 2, &data[0]);
+  stats = vector_stats();
+  assert(stats.move_bytes == prior.move_bytes + 4 * sizeof(int));
+
+  // It counts the bytes moved by a removal
+  prior = stats;
+  vector = vector_remove(vector, 1);
+  stats = vector_stats();
+  assert(stats.move_bytes == prior.move_bytes + 5 * sizeof(int));
+  assert_vector_data(vector, 1, 1, 3, 5, 8, 13);
+
+  // It counts each failed allocation
+  prior = stats;
+  realloc_errno = ENOENT;
+  assert(vector_resize(vector, 100) == NULL);
+  realloc_errno = 0;
+  stats = vector_stats();
+  assert(stats.failure == prior.failure + 1);
+
+  // The global counters include the counters of the calling thread
+  struct vector_stats_t global = vector_stats_global();
+  assert(global.allocate >= stats.allocate);
+  assert(global.allocate_bytes >= stats.allocate_bytes);
+  assert(global.reallocate >= stats.reallocate);
+  assert(global.reallocate_bytes >= stats.reallocate_bytes);
+  assert(global.move_bytes >= stats.move_bytes);
+  assert(global.grow >= stats.grow);
+  assert(global.shrink >= stats.shrink);
+  assert(global.failure >= stats.failure);
+
+  vector_delete(vector);
+}
+
+int main() {
+  test_vector_stats();
+}